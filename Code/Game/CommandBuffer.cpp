@@ -0,0 +1,40 @@
+#include "Game/CommandBuffer.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+
+thread_local CommandBuffer* CommandBuffer::s_recordingBuffer = nullptr;
+
+//-----------------------------------------------------------------------------------
+void CommandBuffer::Execute()
+{
+    //Commands can record more commands if they run while another buffer is recording, so index instead of iterating.
+    for (unsigned int i = 0; i < m_commands.size(); ++i)
+    {
+        m_commands[i]();
+    }
+    m_commands.clear();
+}
+
+//-----------------------------------------------------------------------------------
+void CommandBuffer::BeginRecording(CommandBuffer* buffer)
+{
+    ASSERT_OR_DIE(s_recordingBuffer == nullptr, "Already recording into a command buffer on this thread");
+    s_recordingBuffer = buffer;
+}
+
+//-----------------------------------------------------------------------------------
+void CommandBuffer::EndRecording()
+{
+    s_recordingBuffer = nullptr;
+}
+
+//Returns true if the command was recorded for later, false if the caller should just do it now.
+//-----------------------------------------------------------------------------------
+bool CommandBuffer::DeferIfRecording(const std::function<void()>& command)
+{
+    if (!s_recordingBuffer)
+    {
+        return false;
+    }
+    s_recordingBuffer->Record(command);
+    return true;
+}
@@ -0,0 +1,25 @@
+#pragma once
+#include <vector>
+#include <functional>
+
+//Side effects recorded while entities update off the main thread: spawns, sounds, particles and damage numbers.
+//Each buffer is executed on the main thread afterwards, in the order the commands were recorded.
+//-----------------------------------------------------------------------------------
+class CommandBuffer
+{
+public:
+    //FUNCTIONS/////////////////////////////////////////////////////////////////////
+    inline void Record(const std::function<void()>& command) { m_commands.push_back(command); };
+    void Execute();
+    inline unsigned int GetNumCommands() const { return m_commands.size(); };
+
+    //STATIC FUNCTIONS/////////////////////////////////////////////////////////////////////
+    static void BeginRecording(CommandBuffer* buffer);
+    static void EndRecording();
+    static bool DeferIfRecording(const std::function<void()>& command);
+
+private:
+    //MEMBER VARIABLES/////////////////////////////////////////////////////////////////////
+    std::vector<std::function<void()>> m_commands;
+    static thread_local CommandBuffer* s_recordingBuffer;
+};
@@ -1,4 +1,6 @@
 #include "Game/Encounters/Encounter.hpp"
+#include "Game/GameModes/GameMode.hpp"
+#include "Game/LinearArena.hpp"
 
 //-----------------------------------------------------------------------------------
 Encounter::Encounter(const Vector2& center, float radius)
@@ -13,3 +15,17 @@ Vector2 Encounter::CalculateSpawnPosition(const Vector2& relative01Position)
 {
     return m_center + (relative01Position * m_radius);
 }
+
+//-----------------------------------------------------------------------------------
+void* Encounter::operator new(size_t size)
+{
+    LinearArena* arena = GameMode::GetCurrentArena();
+    ASSERT_OR_DIE(arena, "Encounters can only be created while a game mode is current");
+    return arena->Allocate(size);
+}
+
+//-----------------------------------------------------------------------------------
+void Encounter::operator delete(void* storage)
+{
+    UNUSED(storage);
+}
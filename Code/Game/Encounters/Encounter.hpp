@@ -8,6 +8,11 @@ public:
     //CONSTRUCTORS/////////////////////////////////////////////////////////////////////
     Encounter(const Vector2& center, float radius);
 
+    //ALLOCATION/////////////////////////////////////////////////////////////////////
+    //Encounters live in the current mode's arena and are never deleted one by one; the mode resets the arena instead.
+    static void* operator new(size_t size);
+    static void operator delete(void* storage);
+
     //FUNCTIONS/////////////////////////////////////////////////////////////////////
     virtual void Spawn() = 0;
     virtual Vector2 CalculateSpawnPosition(const Vector2& relative01Position);
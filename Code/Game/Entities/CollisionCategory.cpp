@@ -0,0 +1,56 @@
+#include "Game/Entities/CollisionCategory.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+
+bool CollisionLayers::g_canCategoriesInteract[NUM_COLLISION_CATEGORIES][NUM_COLLISION_CATEGORIES];
+CollisionMask CollisionLayers::g_interactingCategories[NUM_COLLISION_CATEGORIES];
+
+namespace
+{
+    const CollisionMask SHIP_BIT = 1 << SHIP_CATEGORY;
+    const CollisionMask PLAYER_BIT = 1 << PLAYER_CATEGORY;
+    const CollisionMask PROJECTILE_BIT = 1 << PROJECTILE_CATEGORY;
+    const CollisionMask PICKUP_BIT = 1 << PICKUP_CATEGORY;
+    const CollisionMask PROP_BIT = 1 << PROP_CATEGORY;
+
+    //Mirrors CanPushAgainst and each ResolveCollision: noCollide entities are ignored by the base push-apart,
+    //projectiles only hit things that collide with bullets, pickups only push pickups and props.
+    const CollisionMask DEFAULT_MASKS[NUM_COLLISION_CATEGORIES] =
+    {
+        SHIP_BIT | PLAYER_BIT | PROJECTILE_BIT | PROP_BIT,                  //SHIP_CATEGORY
+        SHIP_BIT | PLAYER_BIT | PROJECTILE_BIT | PROP_BIT,                  //PLAYER_CATEGORY
+        SHIP_BIT | PLAYER_BIT | PROP_BIT,                                   //PROJECTILE_CATEGORY
+        PLAYER_BIT | PICKUP_BIT | PROP_BIT,                                 //PICKUP_CATEGORY
+        SHIP_BIT | PLAYER_BIT | PROJECTILE_BIT | PROP_BIT,                  //PROP_CATEGORY
+        SHIP_BIT | PLAYER_BIT,                                              //FIELD_CATEGORY
+        SHIP_BIT | PLAYER_BIT | PROJECTILE_BIT | PICKUP_BIT | PROP_BIT,     //VORTEX_CATEGORY
+    };
+
+    //-----------------------------------------------------------------------------------
+    bool BuildInteractionTable()
+    {
+        for (int first = 0; first < NUM_COLLISION_CATEGORIES; ++first)
+        {
+            CollisionLayers::g_interactingCategories[first] = 0;
+            for (int second = 0; second < NUM_COLLISION_CATEGORIES; ++second)
+            {
+                bool firstCares = (DEFAULT_MASKS[first] & (1 << second)) != 0;
+                bool secondCares = (DEFAULT_MASKS[second] & (1 << first)) != 0;
+                CollisionLayers::g_canCategoriesInteract[first][second] = firstCares || secondCares;
+                if (firstCares || secondCares)
+                {
+                    CollisionLayers::g_interactingCategories[first] |= (1 << second);
+                }
+            }
+        }
+        return true;
+    }
+
+    const bool s_isInteractionTableBuilt = BuildInteractionTable();
+}
+
+//-----------------------------------------------------------------------------------
+CollisionMask CollisionLayers::GetDefaultMask(CollisionCategory category)
+{
+    ASSERT_OR_DIE(category < NUM_COLLISION_CATEGORIES, "Invalid collision category");
+    return DEFAULT_MASKS[category];
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+typedef unsigned char CollisionMask;
+
+//-----------------------------------------------------------------------------------
+enum CollisionCategory : unsigned char
+{
+    SHIP_CATEGORY = 0,
+    PLAYER_CATEGORY,
+    PROJECTILE_CATEGORY,
+    PICKUP_CATEGORY,
+    PROP_CATEGORY,
+    FIELD_CATEGORY,
+    VORTEX_CATEGORY,
+    NUM_COLLISION_CATEGORIES
+};
+
+static const CollisionMask ALL_COLLISION_CATEGORIES = (1 << NUM_COLLISION_CATEGORIES) - 1;
+
+//Which categories a category's collision response actually does something to.
+//A pair is only tested if at least one side cares about the other.
+//-----------------------------------------------------------------------------------
+namespace CollisionLayers
+{
+    inline CollisionMask GetCategoryBit(CollisionCategory category) { return (CollisionMask)(1 << category); };
+    extern bool g_canCategoriesInteract[NUM_COLLISION_CATEGORIES][NUM_COLLISION_CATEGORIES];
+    extern CollisionMask g_interactingCategories[NUM_COLLISION_CATEGORIES];
+
+    CollisionMask GetDefaultMask(CollisionCategory category);
+    inline bool CanCategoriesInteract(CollisionCategory first, CollisionCategory second) { return g_canCategoriesInteract[first][second]; };
+    inline CollisionMask GetInteractingCategories(CollisionCategory category) { return g_interactingCategories[category]; };
+    inline bool CanMasksInteract(CollisionCategory first, CollisionMask firstMask, CollisionCategory second, CollisionMask secondMask)
+    {
+        return ((firstMask & GetCategoryBit(second)) | (secondMask & GetCategoryBit(first))) != 0;
+    };
+}
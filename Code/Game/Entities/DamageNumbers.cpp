@@ -0,0 +1,163 @@
+#include "Game/Entities/DamageNumbers.hpp"
+#include "Engine/Renderer/2D/TextRenderable2D.hpp"
+#include "Engine/Math/Transform2D.hpp"
+#include "Game/TheGame.hpp"
+#include "Game/CommandBuffer.hpp"
+#include "Game/GameCommon.hpp"
+
+DamageNumbers::Slot DamageNumbers::s_slots[DamageNumbers::CAPACITY];
+unsigned int DamageNumbers::s_oldest = 0;
+unsigned int DamageNumbers::s_numLive = 0;
+bool DamageNumbers::s_areSlotsAllocated = false;
+
+//-----------------------------------------------------------------------------------
+void DamageNumbers::AllocateSlots()
+{
+    for (Slot& slot : s_slots)
+    {
+        slot.m_textRenderable = new TextRenderable2D("0", Transform2D(), TheGame::TEXT_PARTICLE_LAYER, true);
+        slot.m_textRenderable->m_fontSize /= 3.5f;
+        slot.m_textRenderable->Disable();
+    }
+    s_areSlotsAllocated = true;
+}
+
+//-----------------------------------------------------------------------------------
+void DamageNumbers::Cleanup()
+{
+    for (Slot& slot : s_slots)
+    {
+        delete slot.m_textRenderable;
+        slot.m_textRenderable = nullptr;
+    }
+    s_oldest = 0;
+    s_numLive = 0;
+    s_areSlotsAllocated = false;
+}
+
+//-----------------------------------------------------------------------------------
+//Short enough to stay inside std::string's small buffer, so assigning it to the renderable doesn't allocate.
+unsigned int DamageNumbers::FormatDigits(int value, char* digits)
+{
+    char reversed[MAX_DIGITS];
+    unsigned int numReversed = 0;
+    unsigned int magnitude = value < 0 ? 0u - (unsigned int)value : (unsigned int)value;
+    do
+    {
+        reversed[numReversed++] = (char)('0' + (magnitude % 10));
+        magnitude /= 10;
+    } while (magnitude > 0);
+
+    unsigned int numDigits = 0;
+    if (value < 0)
+    {
+        digits[numDigits++] = '-';
+    }
+    while (numReversed > 0)
+    {
+        digits[numDigits++] = reversed[--numReversed];
+    }
+    return numDigits;
+}
+
+//-----------------------------------------------------------------------------------
+//Deferred like TextSplash when called during a parallel update. Numbers are keyed by handle, so a new entity
+//that happens to reuse a dead one's address never merges into the dead one's number.
+void DamageNumbers::Spawn(EntityHandle target, Kind kind, int value, const Transform2D& spawnTransform, const Vector2& velocity, RGBA color)
+{
+    Vector2 spawnPosition = spawnTransform.GetWorldPosition();
+    if (CommandBuffer::DeferIfRecording([=]() { Spawn(target, kind, value, Transform2D(spawnPosition), velocity, color); }))
+    {
+        return;
+    }
+    if (!s_areSlotsAllocated)
+    {
+        AllocateSlots();
+    }
+
+    Slot* coalescingSlot = FindCoalescingSlot(target, kind);
+    if (coalescingSlot)
+    {
+        ++coalescingSlot->m_numMerges;
+        SetSlotValue(*coalescingSlot, coalescingSlot->m_value + value);
+        float scale = MathUtils::Clamp(1.0f + (SCALE_PER_MERGE * (float)coalescingSlot->m_numMerges), 1.0f, MAX_MERGED_SCALE);
+        coalescingSlot->m_textRenderable->m_transform.SetScale(Vector2(scale));
+        return;
+    }
+
+    if (s_numLive == CAPACITY)
+    {
+        RetireOldest();
+    }
+    Slot& slot = s_slots[(s_oldest + s_numLive) % CAPACITY];
+    ++s_numLive;
+    slot.m_target = target;
+    slot.m_kind = kind;
+    slot.m_velocity = velocity;
+    slot.m_age = 0.0f;
+    slot.m_numMerges = 0;
+    SetSlotValue(slot, value);
+
+    TextRenderable2D* text = slot.m_textRenderable;
+    text->m_color = color;
+    text->m_transform.SetPosition(spawnPosition);
+    text->m_transform.SetRotationDegrees(0.0f);
+    text->m_transform.SetScale(Vector2(1.0f));
+    text->Enable();
+}
+
+//-----------------------------------------------------------------------------------
+//Walks back from the newest number, stopping as soon as numbers are older than the window.
+//Merging never resets a number's age, so the ring stays ordered by expiry.
+DamageNumbers::Slot* DamageNumbers::FindCoalescingSlot(EntityHandle target, Kind kind)
+{
+    if (g_damageNumberCoalesceSeconds <= 0.0f)
+    {
+        return nullptr;
+    }
+    for (unsigned int i = s_numLive; i > 0; --i)
+    {
+        Slot& slot = s_slots[(s_oldest + i - 1) % CAPACITY];
+        if (slot.m_age > g_damageNumberCoalesceSeconds)
+        {
+            break;
+        }
+        if (slot.m_target == target && slot.m_kind == kind)
+        {
+            return &slot;
+        }
+    }
+    return nullptr;
+}
+
+//-----------------------------------------------------------------------------------
+void DamageNumbers::SetSlotValue(Slot& slot, int value)
+{
+    slot.m_value = value;
+    slot.m_numDigits = FormatDigits(value, slot.m_digits);
+    slot.m_textRenderable->m_text.assign(slot.m_digits, slot.m_numDigits);
+}
+
+//-----------------------------------------------------------------------------------
+void DamageNumbers::Update(float deltaSeconds)
+{
+    for (unsigned int i = 0; i < s_numLive; ++i)
+    {
+        Slot& slot = s_slots[(s_oldest + i) % CAPACITY];
+        slot.m_age += deltaSeconds;
+        Vector2 newPosition = slot.m_textRenderable->m_transform.GetWorldPosition() + (slot.m_velocity * deltaSeconds);
+        slot.m_textRenderable->m_transform.SetPosition(newPosition);
+    }
+    while (s_numLive > 0 && s_slots[s_oldest].m_age > MAX_AGE)
+    {
+        RetireOldest();
+    }
+}
+
+//-----------------------------------------------------------------------------------
+void DamageNumbers::RetireOldest()
+{
+    s_slots[s_oldest].m_textRenderable->Disable();
+    s_oldest = (s_oldest + 1) % CAPACITY;
+    --s_numLive;
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include "Engine\Math\Vector2.hpp"
+#include "Engine\Renderer\RGBA.hpp"
+#include "Game/Entities/EntityRegistry.hpp"
+
+class TextRenderable2D;
+class Transform2D;
+
+//Fixed ring of preallocated text slots for the numbers that pop off ships when they're hit.
+//Every number lives for the same amount of time, so the oldest slot is always the next to expire.
+//Hits on the same target within g_damageNumberCoalesceSeconds add onto its newest number instead of spawning another.
+//-----------------------------------------------------------------------------------
+class DamageNumbers
+{
+public:
+    //ENUMS/////////////////////////////////////////////////////////////////////
+    enum Kind : unsigned char
+    {
+        SHIELD_DAMAGE = 0,
+        HULL_DAMAGE,
+        NUM_KINDS
+    };
+
+    //STATIC FUNCTIONS/////////////////////////////////////////////////////////////////////
+    static void Spawn(EntityHandle target, Kind kind, int value, const Transform2D& spawnTransform, const Vector2& velocity, RGBA color);
+    static void Update(float deltaSeconds);
+    static void Cleanup();
+    static inline unsigned int GetNumLiveNumbers() { return s_numLive; };
+
+    //CONSTANTS/////////////////////////////////////////////////////////////////////
+    static constexpr unsigned int CAPACITY = 128;
+    static constexpr unsigned int MAX_DIGITS = 12;
+    static constexpr float MAX_AGE = 1.0f;
+    static constexpr float SCALE_PER_MERGE = 0.1f;
+    static constexpr float MAX_MERGED_SCALE = 1.5f;
+
+private:
+    struct Slot
+    {
+        TextRenderable2D* m_textRenderable = nullptr;
+        EntityHandle m_target;
+        Vector2 m_velocity;
+        float m_age = 0.0f;
+        int m_value = 0;
+        unsigned int m_numMerges = 0;
+        Kind m_kind = HULL_DAMAGE;
+        unsigned int m_numDigits = 0;
+        char m_digits[MAX_DIGITS];
+    };
+
+    static void AllocateSlots();
+    static Slot* FindCoalescingSlot(EntityHandle target, Kind kind);
+    static void SetSlotValue(Slot& slot, int value);
+    static unsigned int FormatDigits(int value, char* digits);
+    static void RetireOldest();
+
+    //STATIC VARIABLES/////////////////////////////////////////////////////////////////////
+    static Slot s_slots[CAPACITY];
+    static unsigned int s_oldest;
+    static unsigned int s_numLive;
+    static bool s_areSlotsAllocated;
+};
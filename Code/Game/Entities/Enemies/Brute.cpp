@@ -15,11 +15,12 @@ const float Brute::MAX_ANGULAR_VELOCITY = 15.0f;
 //-----------------------------------------------------------------------------------
 Brute::Brute(const Vector2& initialPosition)
     : Ship()
-    , m_angularVelocity(MathUtils::GetRandomFloatFromZeroTo(MAX_ANGULAR_VELOCITY) - (MAX_ANGULAR_VELOCITY * 2.0f))
 {
+    SetKind(BRUTE_KIND);
+    m_angularVelocity = MathUtils::GetRandomFloatFromZeroTo(MAX_ANGULAR_VELOCITY) - (MAX_ANGULAR_VELOCITY * 2.0f);
     m_pilot = new BasicEnemyPilot();
     m_sprite = new Sprite("Brute", TheGame::ENEMY_LAYER);
-    m_shieldSprite->m_material = m_sprite->m_material;
+    m_loadout->m_shieldSprite->m_material = m_sprite->m_material;
     m_shipTrail->m_emitters[0]->m_materialOverride = m_sprite->m_material;
 
     m_sprite->m_transform.SetParent(&m_transform);
@@ -28,11 +29,12 @@ Brute::Brute(const Vector2& initialPosition)
     CalculateCollisionRadius();
     SetPosition(initialPosition);
 
-    m_baseStats.topSpeed = 1.0f;
-    m_baseStats.rateOfFire -= 5.0f;
-    m_baseStats.hp += 6.0f;
-    //m_baseStats.shieldCapacity -= 2.0f; 
-    m_weapon = new SpreadShot();
+    m_loadout->m_baseStats.topSpeed = 1.0f;
+    m_loadout->m_baseStats.rateOfFire -= 5.0f;
+    m_loadout->m_baseStats.hp += 6.0f;
+    //m_loadout->m_baseStats.shieldCapacity -= 2.0f; 
+    m_loadout->m_weapon = new SpreadShot();
+    InvalidateStatValues();
     SetShieldHealth();
     Heal();
 }
@@ -14,11 +14,12 @@ const float Grunt::MAX_ANGULAR_VELOCITY = 15.0f;
 //-----------------------------------------------------------------------------------
 Grunt::Grunt(const Vector2& initialPosition)
     : Ship()
-    , m_angularVelocity(MathUtils::GetRandomFloatFromZeroTo(MAX_ANGULAR_VELOCITY) - (MAX_ANGULAR_VELOCITY * 2.0f))
 {
+    SetKind(GRUNT_KIND);
+    m_angularVelocity = MathUtils::GetRandomFloatFromZeroTo(MAX_ANGULAR_VELOCITY) - (MAX_ANGULAR_VELOCITY * 2.0f);
     m_pilot = new BasicEnemyPilot();
     m_sprite = new Sprite("Grunt", TheGame::ENEMY_LAYER);
-    m_shieldSprite->m_material = m_sprite->m_material;
+    m_loadout->m_shieldSprite->m_material = m_sprite->m_material;
     m_shipTrail->m_emitters[0]->m_materialOverride = m_sprite->m_material;
 
     m_sprite->m_transform.SetParent(&m_transform);
@@ -27,10 +28,11 @@ Grunt::Grunt(const Vector2& initialPosition)
     CalculateCollisionRadius();
     SetPosition(initialPosition);
 
-    m_baseStats.topSpeed = 2.0f;
-    m_baseStats.rateOfFire -= 5.0f;
-    m_baseStats.hp -= 2.0f;
-    m_baseStats.shieldCapacity -= 2.0f; 
+    m_loadout->m_baseStats.topSpeed = 2.0f;
+    m_loadout->m_baseStats.rateOfFire -= 5.0f;
+    m_loadout->m_baseStats.hp -= 2.0f;
+    m_loadout->m_baseStats.shieldCapacity -= 2.0f; 
+    InvalidateStatValues();
     SetShieldHealth();
     Heal();
 }
@@ -12,7 +12,6 @@ public:
     virtual void Die();
 
     //MEMBER VARIABLES/////////////////////////////////////////////////////////////////////
-    float m_angularVelocity;
 
     //CONSTANTS/////////////////////////////////////////////////////////////////////
     static const float MAX_ANGULAR_VELOCITY;
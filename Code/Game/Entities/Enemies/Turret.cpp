@@ -14,9 +14,10 @@
 Turret::Turret(const Vector2& initialPosition)
     : Ship()
 {
+    SetKind(TURRET_KIND);
     m_pilot = new TurretPilot();
     m_sprite = new Sprite("Turret", TheGame::ENEMY_LAYER);
-    m_shieldSprite->m_material = m_sprite->m_material;
+    m_loadout->m_shieldSprite->m_material = m_sprite->m_material;
     m_shipTrail->m_emitters[0]->m_materialOverride = m_sprite->m_material;
 
     m_sprite->m_transform.SetParent(&m_transform);
@@ -26,14 +27,16 @@ Turret::Turret(const Vector2& initialPosition)
     SetPosition(initialPosition);
 
     m_isImmobile = true;
-    m_weapon = new MissileLauncher();
+    m_isStatic = true;
+    m_loadout->m_weapon = new MissileLauncher();
 
-    m_baseStats.topSpeed = 0.0f;
-    m_baseStats.acceleration = 0.0f;
-    m_baseStats.shieldCapacity = 0.0f;
-    m_baseStats.shieldRegen = 0.0f;
-    m_baseStats.rateOfFire -= 10.0f;
-    m_baseStats.hp += 5.0f;
+    m_loadout->m_baseStats.topSpeed = 0.0f;
+    m_loadout->m_baseStats.acceleration = 0.0f;
+    m_loadout->m_baseStats.shieldCapacity = 0.0f;
+    m_loadout->m_baseStats.shieldRegen = 0.0f;
+    m_loadout->m_baseStats.rateOfFire -= 10.0f;
+    m_loadout->m_baseStats.hp += 5.0f;
+    InvalidateStatValues();
     SetShieldHealth(0.0f);
     Heal();
 }
@@ -7,81 +7,133 @@
 #include "Game/StateMachine.hpp"
 #include "Game/TheGame.hpp"
 #include "Game/GameCommon.hpp"
+#include "Game/StatCurves.hpp"
 #include <algorithm>
 #include "Engine/Renderer/Material.hpp"
-#include "TextSplash.hpp"
+#include "DamageNumbers.hpp"
 #include "PlayerShip.hpp"
+#include "Game/GameModes/GameMode.hpp"
 
 Vector2 Entity::SHIELD_SCALE_FUDGE_VALUE = Vector2(0.1f);
+std::atomic<unsigned int> Entity::s_nextEntityId(0);
 
 //-----------------------------------------------------------------------------------
-Entity::Entity()
+Entity::Entity(EntityLoadout* loadout /*= nullptr*/)
     : m_sprite(nullptr)
-    , m_shieldSprite(new Sprite("Shield", TheGame::SHIELD_LAYER, false))
+    , m_loadout(loadout)
     , m_currentHp(1.0f)
     , m_collisionRadius(1.0f)
     , m_age(0.0f)
     , m_isDead(false)
-    , m_weapon(nullptr)
-    , m_chassis(nullptr)
-    , m_activeEffect(nullptr)
-    , m_passiveEffect(nullptr)
-    , m_baseStats(6.0f)
     , m_velocity(0.0f)
     , m_frictionValue(0.9f)
     , m_collidesWithBullets(true)
     , m_isInvincible(false)
-    , m_owner(nullptr)
     , m_noCollide(false)
-    , m_currentShieldHealth(0.0f)
+    , m_entityId(s_nextEntityId++)
+    , m_handle(EntityRegistry::instance->Register(this))
 {
-    m_shieldSprite->m_transform.SetParent(&m_transform);
-    m_shieldSprite->m_transform.IgnoreParentRotation();
+    if (m_loadout && m_loadout->m_shieldSprite)
+    {
+        m_loadout->m_shieldSprite->m_transform.SetParent(&m_transform);
+        m_loadout->m_shieldSprite->m_transform.IgnoreParentRotation();
+    }
+    SetCollisionCategory(PROP_CATEGORY);
 }
 
 //-----------------------------------------------------------------------------------
 Entity::~Entity()
 {
-    if (m_sprite)
+    EntityRegistry::instance->Unregister(m_handle);
+    if (m_transformCache)
     {
-        delete m_sprite;
+        m_transformCache->Forget(m_transformCacheIndex);
     }
-    delete m_shieldSprite;
-    if (GetGameState() == GameState::ASSEMBLY_PLAYING)
+    if (m_sprite)
     {
-        DropInventory();
+        delete m_sprite;
     }
-    else
+    if (m_loadout)
     {
-        DeleteInventory();
+        if (GetGameState() == GameState::ASSEMBLY_PLAYING)
+        {
+            DropInventory();
+        }
+        else
+        {
+            DeleteInventory();
+        }
+        delete m_loadout;
     }
-    if (m_weapon)
+}
+
+//-----------------------------------------------------------------------------------
+void Entity::Update(float deltaSeconds)
+{
+    constexpr float FIXED_TIMESTEP = GameMode::FIXED_STEP_SECONDS;
+    m_age += deltaSeconds;
+    m_timeSinceLastHit += deltaSeconds;
+    Vector2 accelerationDueToImpulses = m_sumOfImpulses / m_mass;
+    m_velocity += (accelerationDueToImpulses * FIXED_TIMESTEP);
+    m_sumOfImpulses = Vector2::ZERO; //Only applied for a frame.
+}
+
+//-----------------------------------------------------------------------------------
+void Entity::RecordPreviousSimState()
+{
+    m_previousSimPosition = m_transform.GetWorldPosition();
+    m_previousSimRotation = m_transform.GetWorldRotationDegrees();
+    m_hasPreviousSimState = true;
+}
+
+//-----------------------------------------------------------------------------------
+void Entity::ShowInterpolatedState(float alpha)
+{
+    if (!m_hasPreviousSimState)
     {
-        delete m_weapon;
+        return;
     }
-    if (m_chassis)
+    m_simPosition = m_transform.GetWorldPosition();
+    m_simRotation = m_transform.GetWorldRotationDegrees();
+
+    //Teleports and respawns snap instead of sliding across the arena.
+    if (MathUtils::CalcDistSquaredBetweenPoints(m_previousSimPosition, m_simPosition) > MAX_INTERPOLATION_DISTANCE * MAX_INTERPOLATION_DISTANCE)
     {
-        delete m_chassis;
+        return;
     }
-    if (m_passiveEffect)
+    float rotationDelta = fmod(m_simRotation - m_previousSimRotation, 360.0f);
+    if (rotationDelta > 180.0f)
     {
-        delete m_passiveEffect;
+        rotationDelta -= 360.0f;
     }
-    if (m_activeEffect)
+    else if (rotationDelta < -180.0f)
     {
-        delete m_activeEffect;
+        rotationDelta += 360.0f;
     }
+    m_renderPosition = MathUtils::Lerp(alpha, m_previousSimPosition, m_simPosition);
+    m_transform.SetPosition(m_renderPosition);
+    m_transform.SetRotationDegrees(m_simRotation - (rotationDelta * (1.0f - alpha)));
+    MarkTransformDirty();
+    m_isShowingInterpolatedState = true;
 }
 
 //-----------------------------------------------------------------------------------
-void Entity::Update(float deltaSeconds)
+void Entity::RestoreSimState()
 {
-    constexpr float FIXED_TIMESTEP = (1.0f / 60.0f);
-    m_age += deltaSeconds;
-    m_timeSinceLastHit += deltaSeconds;
-    Vector2 accelerationDueToImpulses = m_sumOfImpulses / m_mass;
-    m_velocity += (accelerationDueToImpulses * FIXED_TIMESTEP);
-    m_sumOfImpulses = Vector2::ZERO; //Only applied for a frame.
+    if (!m_isShowingInterpolatedState)
+    {
+        return;
+    }
+    m_isShowingInterpolatedState = false;
+
+    //If something outside the sim moved us since we were drawn, that position wins.
+    Vector2 currentPosition = m_transform.GetWorldPosition();
+    if (currentPosition.x == m_renderPosition.x && currentPosition.y == m_renderPosition.y)
+    {
+        m_transform.SetPosition(m_simPosition);
+        m_transform.SetRotationDegrees(m_simRotation);
+        MarkTransformDirty();
+    }
 }
 
 //-----------------------------------------------------------------------------------
@@ -93,55 +145,73 @@ bool Entity::IsCollidingWith(Entity* otherEntity)
 }
 
 //-----------------------------------------------------------------------------------
-void Entity::ResolveCollision(Entity* otherEntity)
+void Entity::ResolveContact(Entity* first, Entity* second)
 {
-    if (m_isDead || otherEntity->m_isDead || m_noCollide || otherEntity->m_noCollide || otherEntity == m_owner || otherEntity->m_owner == this || (!m_collidesWithBullets && (otherEntity->IsProjectile() || IsProjectile())))
+    if (first->CanPushAgainst(second) || second->CanPushAgainst(first))
     {
-        return;
+        SeparateEntities(first, second);
+        ApplyContactDamage(first, second);
+        ApplyContactDamage(second, first);
+    }
+    CollisionHandler firstHandler = EntityKinds::GetCollisionHandler(first->m_kind, second->m_kind);
+    if (firstHandler)
+    {
+        firstHandler(first, second);
+    }
+    CollisionHandler secondHandler = EntityKinds::GetCollisionHandler(second->m_kind, first->m_kind);
+    if (secondHandler)
+    {
+        secondHandler(second, first);
     }
+}
 
-    Vector2 myPosition = GetPosition();
-    Vector2 otherPosition = otherEntity->GetPosition();
-    Vector2 displacementFromOtherToMe = myPosition - otherPosition;
-    Vector2 directionFromOtherToMe = displacementFromOtherToMe.GetNorm();
+//-----------------------------------------------------------------------------------
+void Entity::SeparateEntities(Entity* first, Entity* second)
+{
+    Vector2 firstPosition = first->GetPosition();
+    Vector2 secondPosition = second->GetPosition();
+    Vector2 displacementFromSecondToFirst = firstPosition - secondPosition;
+    Vector2 directionFromSecondToFirst = displacementFromSecondToFirst.GetNorm();
 
-    float distanceBetweenEntities = displacementFromOtherToMe.CalculateMagnitude();
-    float sumOfRadii = m_collisionRadius + otherEntity->m_collisionRadius;
+    float distanceBetweenEntities = displacementFromSecondToFirst.CalculateMagnitude();
+    float sumOfRadii = first->m_collisionRadius + second->m_collisionRadius;
     float overlapDistance = sumOfRadii - distanceBetweenEntities;
     float pushDistance = overlapDistance * 0.5f;
-    Vector2 myPositionCorrection = directionFromOtherToMe * pushDistance;
-    if (!m_isImmobile)
+    Vector2 firstPositionCorrection = directionFromSecondToFirst * pushDistance;
+    if (!first->m_isImmobile)
     {
-        SetPosition(myPosition + myPositionCorrection);
+        first->SetPosition(firstPosition + firstPositionCorrection);
     }
-    if (!otherEntity->m_isImmobile)
+    if (!second->m_isImmobile)
     {
-        otherEntity->SetPosition(otherPosition - myPositionCorrection); 
+        second->SetPosition(secondPosition - firstPositionCorrection);
     }
+}
 
+//-----------------------------------------------------------------------------------
+void Entity::ApplyContactDamage(Entity* attacker, Entity* victim)
+{
     //Take damage from the collision if anything does damage on contact
-    if (m_collisionDamageAmount > 0.0f && otherEntity->CanTakeContactDamage())
+    if (attacker->m_collisionDamageAmount > 0.0f && victim->CanTakeContactDamage())
     {
-        otherEntity->TakeDamage(m_collisionDamageAmount);
-        if (otherEntity->IsDead() && otherEntity->IsPlayer() && (IsPlayer() || (m_owner && m_owner->IsPlayer())))
+        victim->TakeDamage(attacker->m_collisionDamageAmount);
+        Entity* killer = attacker->IsPlayer() ? attacker : attacker->GetOwner();
+        if (victim->IsDead() && victim->IsPlayer() && killer && killer->IsPlayer())
         {
-            PlayerShip* player = IsPlayer() ? dynamic_cast<PlayerShip*>(this) : dynamic_cast<PlayerShip*>(m_owner);
-            PlayerShip* victim = dynamic_cast<PlayerShip*>(otherEntity);
-            ASSERT_OR_DIE(player && victim, "Somehow got a player and victim to not be players.");
-            GameMode::GetCurrent()->RecordPlayerKill(player, victim);
+            PlayerShip* player = static_cast<PlayerShip*>(killer);
+            GameMode::GetCurrent()->RecordPlayerKill(player, static_cast<PlayerShip*>(victim));
         }
     }
-    if (otherEntity->m_collisionDamageAmount > 0.0f && CanTakeContactDamage())
+}
+
+//-----------------------------------------------------------------------------------
+bool Entity::CanPushAgainst(Entity* otherEntity)
+{
+    if (m_isDead || otherEntity->m_isDead || m_noCollide || otherEntity->m_noCollide || otherEntity->m_handle == m_owner || otherEntity->m_owner == m_handle || (!m_collidesWithBullets && (otherEntity->IsProjectile() || IsProjectile())))
     {
-        TakeDamage(otherEntity->m_collisionDamageAmount);
-        if (IsDead() && IsPlayer() && (otherEntity->IsPlayer() || (otherEntity->m_owner && otherEntity->m_owner->IsPlayer())))
-        {
-            PlayerShip* player = otherEntity->IsPlayer() ? dynamic_cast<PlayerShip*>(otherEntity) : dynamic_cast<PlayerShip*>(otherEntity->m_owner);
-            PlayerShip* victim = dynamic_cast<PlayerShip*>(this);
-            ASSERT_OR_DIE(player && victim, "Somehow got a player and victim to not be players.");
-            GameMode::GetCurrent()->RecordPlayerKill(player, victim);
-        }
+        return false;
     }
+    return true;
 }
 
 //-----------------------------------------------------------------------------------
@@ -169,9 +239,9 @@ float Entity::TakeDamage(float damage, float disruption /*= 1.0f*/)
     if (HasShield())
     {
         float adjustedDamage = damage + (damage * disruption);
-        SetShieldHealth(m_currentShieldHealth - adjustedDamage);
+        SetShieldHealth(m_loadout->m_currentShieldHealth - adjustedDamage);
         damageDealt = adjustedDamage;
-        TextSplash::CreateTextSplash(Stringf("%i", static_cast<int>(damageDealt)), m_transform, velocity, RGBA(0.0f, 0.8f + randomPercentage, 1.0f, 1.0f));
+        DamageNumbers::Spawn(m_handle, DamageNumbers::SHIELD_DAMAGE, static_cast<int>(damageDealt), m_transform, velocity, RGBA(0.0f, 0.8f + randomPercentage, 1.0f, 1.0f));
     }
     else
     {
@@ -179,7 +249,7 @@ float Entity::TakeDamage(float damage, float disruption /*= 1.0f*/)
         damageDealt = damage;
         if (ShowsDamageNumbers())
         {
-            TextSplash::CreateTextSplash(Stringf("%i", static_cast<int>(damageDealt)), m_transform, velocity, RGBA(1.0f, 1.0f - (0.8f + randomPercentage), 0.0f, 1.0f));
+            DamageNumbers::Spawn(m_handle, DamageNumbers::HULL_DAMAGE, static_cast<int>(damageDealt), m_transform, velocity, RGBA(1.0f, 1.0f - (0.8f + randomPercentage), 0.0f, 1.0f));
         }
         if (m_currentHp <= 0.0f)
         {
@@ -203,8 +273,27 @@ void Entity::CalculateCollisionRadius()
     m_collisionRadius = maxVirtualSize * maxSpriteScale;
 
     //Get the shield to match the scale of the entity, then add more to encompass it entirely.
-    Vector2 scale = Vector2(m_collisionRadius * 3.0f) / (m_shieldSprite->m_spriteResource->m_virtualSize);
-    m_shieldSprite->m_transform.SetScale(scale + SHIELD_SCALE_FUDGE_VALUE);
+    if (m_loadout && m_loadout->m_shieldSprite)
+    {
+        Sprite* shieldSprite = m_loadout->m_shieldSprite;
+        Vector2 scale = Vector2(m_collisionRadius * 3.0f) / (shieldSprite->m_spriteResource->m_virtualSize);
+        shieldSprite->m_transform.SetScale(scale + SHIELD_SCALE_FUDGE_VALUE);
+    }
+}
+
+//-----------------------------------------------------------------------------------
+void Entity::SetCollisionCategory(CollisionCategory category)
+{
+    m_collisionCategory = category;
+    m_collisionMask = CollisionLayers::GetDefaultMask(category);
+}
+
+//-----------------------------------------------------------------------------------
+void Entity::SetKind(EntityKind kind)
+{
+    ASSERT_OR_DIE(kind < NUM_ENTITY_KINDS, "Invalid entity kind");
+    m_kind = kind;
+    m_kindFlags = EntityKinds::GetFlags(kind);
 }
 
 //-----------------------------------------------------------------------------------
@@ -225,284 +314,239 @@ void Entity::SetPosition(const Vector2& newPosition)
     }
 
     m_transform.SetPosition(adjustedPosition);
+    MarkTransformDirty();
 }
 
 //-----------------------------------------------------------------------------------
 void Entity::SetRotation(const float newDegreesRotation)
 {
     m_transform.SetRotationDegrees(newDegreesRotation);
+    MarkTransformDirty();
+}
+
+//-----------------------------------------------------------------------------------
+void Entity::MarkTransformDirty()
+{
+    if (m_transformCache)
+    {
+        m_transformCache->MarkDirty(m_transformCacheIndex);
+    }
 }
 
 //-----------------------------------------------------------------------------------
 void Entity::Heal(float healValue)
 {
     m_currentHp += healValue;
-    m_currentHp = MathUtils::Clamp(m_currentHp, 0.0f, CalculateHpValue());
+    m_currentHp = MathUtils::Clamp(m_currentHp, 0.0f, GetHpValue());
+}
+
+//-----------------------------------------------------------------------------------
+const Stats& Entity::GetStatValues()
+{
+    ASSERT_OR_DIE(m_loadout, "Only entities with a loadout cache their stat values");
+    Stats& statValues = m_loadout->m_statValues;
+    if (m_loadout->m_areStatValuesDirty)
+    {
+        RecalculateStatValues(statValues);
+        m_loadout->m_areStatValuesDirty = false;
+    }
+    else if (g_verifyStatCache)
+    {
+        Stats fresh;
+        RecalculateStatValues(fresh);
+        ASSERT_OR_DIE(statValues.topSpeed == fresh.topSpeed, "Cached topSpeed value is stale");
+        ASSERT_OR_DIE(statValues.acceleration == fresh.acceleration, "Cached acceleration value is stale");
+        ASSERT_OR_DIE(statValues.handling == fresh.handling, "Cached handling value is stale");
+        ASSERT_OR_DIE(statValues.braking == fresh.braking, "Cached braking value is stale");
+        ASSERT_OR_DIE(statValues.damage == fresh.damage, "Cached damage value is stale");
+        ASSERT_OR_DIE(statValues.shieldDisruption == fresh.shieldDisruption, "Cached shieldDisruption value is stale");
+        ASSERT_OR_DIE(statValues.shotHoming == fresh.shotHoming, "Cached shotHoming value is stale");
+        ASSERT_OR_DIE(statValues.rateOfFire == fresh.rateOfFire, "Cached rateOfFire value is stale");
+        ASSERT_OR_DIE(statValues.hp == fresh.hp, "Cached hp value is stale");
+        ASSERT_OR_DIE(statValues.shieldCapacity == fresh.shieldCapacity, "Cached shieldCapacity value is stale");
+        ASSERT_OR_DIE(statValues.shieldRegen == fresh.shieldRegen, "Cached shieldRegen value is stale");
+        ASSERT_OR_DIE(statValues.shotDeflection == fresh.shotDeflection, "Cached shotDeflection value is stale");
+    }
+    return statValues;
+}
+
+//-----------------------------------------------------------------------------------
+void Entity::RecalculateStatValues(Stats& outValues)
+{
+    outValues.topSpeed = CalculateTopSpeedValue();
+    outValues.acceleration = CalculateAccelerationValue();
+    outValues.handling = CalculateHandlingValue();
+    outValues.braking = CalculateBrakingValue();
+    outValues.damage = CalculateDamageValue();
+    outValues.shieldDisruption = CalculateShieldDisruptionValue();
+    outValues.shotHoming = CalculateShotHomingValue();
+    outValues.rateOfFire = CalculateRateOfFireValue();
+    outValues.hp = CalculateHpValue();
+    outValues.shieldCapacity = CalculateShieldCapacityValue();
+    outValues.shieldRegen = CalculateShieldRegenValue();
+    outValues.shotDeflection = CalculateShotDeflectionValue();
 }
 
 //-----------------------------------------------------------------------------------
 float Entity::GetTopSpeedStat()
 {
-    float topSpeed = m_baseStats.topSpeed;
-    topSpeed += m_weapon ? m_weapon->m_statBonuses.topSpeed : 0.0f;
-    topSpeed += m_chassis ? m_chassis->m_statBonuses.topSpeed : 0.0f;
-    topSpeed += m_activeEffect ? m_activeEffect->m_statBonuses.topSpeed : 0.0f;
-    topSpeed += m_passiveEffect ? m_passiveEffect->m_statBonuses.topSpeed : 0.0f;
-    return Clamp<float>(topSpeed, Stats::MIN_LEVEL, Stats::MAX_LEVEL);
+    return m_loadout ? m_loadout->GetTotalStat(&Stats::topSpeed) : DEFAULT_STAT_LEVEL;
 }
 
 //-----------------------------------------------------------------------------------
 float Entity::GetAccelerationStat()
 {
-    float totalAcceleration = m_baseStats.acceleration;
-    totalAcceleration += m_weapon ? m_weapon->m_statBonuses.acceleration : 0.0f;
-    totalAcceleration += m_chassis ? m_chassis->m_statBonuses.acceleration : 0.0f;
-    totalAcceleration += m_activeEffect ? m_activeEffect->m_statBonuses.acceleration : 0.0f;
-    totalAcceleration += m_passiveEffect ? m_passiveEffect->m_statBonuses.acceleration : 0.0f;
-    return Clamp<float>(totalAcceleration, Stats::MIN_LEVEL, Stats::MAX_LEVEL);
+    return m_loadout ? m_loadout->GetTotalStat(&Stats::acceleration) : DEFAULT_STAT_LEVEL;
 }
 
 //-----------------------------------------------------------------------------------
 float Entity::GetHandlingStat()
 {
-    float handling = m_baseStats.handling;
-    handling += m_weapon ? m_weapon->m_statBonuses.handling : 0.0f;
-    handling += m_chassis ? m_chassis->m_statBonuses.handling : 0.0f;
-    handling += m_activeEffect ? m_activeEffect->m_statBonuses.handling : 0.0f;
-    handling += m_passiveEffect ? m_passiveEffect->m_statBonuses.handling : 0.0f;
-    return Clamp<float>(handling, Stats::MIN_LEVEL, Stats::MAX_LEVEL);
+    return m_loadout ? m_loadout->GetTotalStat(&Stats::handling) : DEFAULT_STAT_LEVEL;
 }
 
 //-----------------------------------------------------------------------------------
 float Entity::GetBrakingStat()
 {
-    float braking = m_baseStats.braking;
-    braking += m_weapon ? m_weapon->m_statBonuses.braking : 0.0f;
-    braking += m_chassis ? m_chassis->m_statBonuses.braking : 0.0f;
-    braking += m_activeEffect ? m_activeEffect->m_statBonuses.braking : 0.0f;
-    braking += m_passiveEffect ? m_passiveEffect->m_statBonuses.braking : 0.0f;
-    return Clamp<float>(braking, Stats::MIN_LEVEL, Stats::MAX_LEVEL);
+    return m_loadout ? m_loadout->GetTotalStat(&Stats::braking) : DEFAULT_STAT_LEVEL;
 }
 
 //-----------------------------------------------------------------------------------
 float Entity::GetDamageStat()
 {
-    float damage = m_baseStats.damage;
-    damage += m_weapon ? m_weapon->m_statBonuses.damage : 0.0f;
-    damage += m_chassis ? m_chassis->m_statBonuses.damage : 0.0f;
-    damage += m_activeEffect ? m_activeEffect->m_statBonuses.damage : 0.0f;
-    damage += m_passiveEffect ? m_passiveEffect->m_statBonuses.damage : 0.0f;
-    return Clamp<float>(damage, Stats::MIN_LEVEL, Stats::MAX_LEVEL);
+    return m_loadout ? m_loadout->GetTotalStat(&Stats::damage) : DEFAULT_STAT_LEVEL;
 }
 
 //-----------------------------------------------------------------------------------
 float Entity::GetShieldDisruptionStat()
 {
-    float shieldDisruption = m_baseStats.shieldDisruption;
-    shieldDisruption += m_weapon ? m_weapon->m_statBonuses.shieldDisruption : 0.0f;
-    shieldDisruption += m_chassis ? m_chassis->m_statBonuses.shieldDisruption : 0.0f;
-    shieldDisruption += m_activeEffect ? m_activeEffect->m_statBonuses.shieldDisruption : 0.0f;
-    shieldDisruption += m_passiveEffect ? m_passiveEffect->m_statBonuses.shieldDisruption : 0.0f;
-    return Clamp<float>(shieldDisruption, Stats::MIN_LEVEL, Stats::MAX_LEVEL);
+    return m_loadout ? m_loadout->GetTotalStat(&Stats::shieldDisruption) : DEFAULT_STAT_LEVEL;
 }
 
 //-----------------------------------------------------------------------------------
 float Entity::GetShotHomingStat()
 {
-    float shotHoming = m_baseStats.shotHoming;
-    shotHoming += m_weapon ? m_weapon->m_statBonuses.shotHoming : 0.0f;
-    shotHoming += m_chassis ? m_chassis->m_statBonuses.shotHoming : 0.0f;
-    shotHoming += m_activeEffect ? m_activeEffect->m_statBonuses.shotHoming : 0.0f;
-    shotHoming += m_passiveEffect ? m_passiveEffect->m_statBonuses.shotHoming : 0.0f;
-    return Clamp<float>(shotHoming, Stats::MIN_LEVEL, Stats::MAX_LEVEL);
+    return m_loadout ? m_loadout->GetTotalStat(&Stats::shotHoming) : DEFAULT_STAT_LEVEL;
 }
 
 //-----------------------------------------------------------------------------------
 float Entity::GetRateOfFireStat()
 {
-    float rateOfFire = m_baseStats.rateOfFire;
-    rateOfFire += m_weapon ? m_weapon->m_statBonuses.rateOfFire : 0.0f;
-    rateOfFire += m_chassis ? m_chassis->m_statBonuses.rateOfFire : 0.0f;
-    rateOfFire += m_activeEffect ? m_activeEffect->m_statBonuses.rateOfFire : 0.0f;
-    rateOfFire += m_passiveEffect ? m_passiveEffect->m_statBonuses.rateOfFire : 0.0f;
-    return Clamp<float>(rateOfFire, Stats::MIN_LEVEL, Stats::MAX_LEVEL);
+    return m_loadout ? m_loadout->GetTotalStat(&Stats::rateOfFire) : DEFAULT_STAT_LEVEL;
 }
 
 //-----------------------------------------------------------------------------------
 float Entity::GetHpStat()
 {
-    float hp = m_baseStats.hp;
-    hp += m_weapon ? m_weapon->m_statBonuses.hp : 0.0f;
-    hp += m_chassis ? m_chassis->m_statBonuses.hp : 0.0f;
-    hp += m_activeEffect ? m_activeEffect->m_statBonuses.hp : 0.0f;
-    hp += m_passiveEffect ? m_passiveEffect->m_statBonuses.hp : 0.0f;
-    return Clamp<float>(hp, Stats::MIN_LEVEL, Stats::MAX_LEVEL);
+    return m_loadout ? m_loadout->GetTotalStat(&Stats::hp) : Clamp<float>(m_baseHp, Stats::MIN_LEVEL, Stats::MAX_LEVEL);
 }
 
 //-----------------------------------------------------------------------------------
 float Entity::GetShieldCapacityStat()
 {
-    float shieldCapacity = m_baseStats.shieldCapacity;
-    shieldCapacity += m_weapon ? m_weapon->m_statBonuses.shieldCapacity : 0.0f;
-    shieldCapacity += m_chassis ? m_chassis->m_statBonuses.shieldCapacity : 0.0f;
-    shieldCapacity += m_activeEffect ? m_activeEffect->m_statBonuses.shieldCapacity : 0.0f;
-    shieldCapacity += m_passiveEffect ? m_passiveEffect->m_statBonuses.shieldCapacity : 0.0f;
-    return Clamp<float>(shieldCapacity, Stats::MIN_LEVEL, Stats::MAX_LEVEL);
+    return m_loadout ? m_loadout->GetTotalStat(&Stats::shieldCapacity) : DEFAULT_STAT_LEVEL;
 }
 
 //-----------------------------------------------------------------------------------
 float Entity::GetShieldRegenStat()
 {
-    float shieldRegen = m_baseStats.shieldRegen;
-    shieldRegen += m_weapon ? m_weapon->m_statBonuses.shieldRegen : 0.0f;
-    shieldRegen += m_chassis ? m_chassis->m_statBonuses.shieldRegen : 0.0f;
-    shieldRegen += m_activeEffect ? m_activeEffect->m_statBonuses.shieldRegen : 0.0f;
-    shieldRegen += m_passiveEffect ? m_passiveEffect->m_statBonuses.shieldRegen : 0.0f;
-    return Clamp<float>(shieldRegen, Stats::MIN_LEVEL, Stats::MAX_LEVEL);
+    return m_loadout ? m_loadout->GetTotalStat(&Stats::shieldRegen) : DEFAULT_STAT_LEVEL;
 }
 
 //-----------------------------------------------------------------------------------
 float Entity::GetShotDeflectionStat()
 {
-    float shotDeflection = m_baseStats.shotDeflection;
-    shotDeflection += m_weapon ? m_weapon->m_statBonuses.shotDeflection : 0.0f;
-    shotDeflection += m_chassis ? m_chassis->m_statBonuses.shotDeflection : 0.0f;
-    shotDeflection += m_activeEffect ? m_activeEffect->m_statBonuses.shotDeflection : 0.0f;
-    shotDeflection += m_passiveEffect ? m_passiveEffect->m_statBonuses.shotDeflection : 0.0f;
-    return Clamp<float>(shotDeflection, Stats::MIN_LEVEL, Stats::MAX_LEVEL);
+    return m_loadout ? m_loadout->GetTotalStat(&Stats::shotDeflection) : DEFAULT_STAT_LEVEL;
 }
 
 //-----------------------------------------------------------------------------------
 float Entity::CalculateTopSpeedValue()
 {
-    float topSpeedStat = GetTopSpeedStat();
-    float topSpeedStatZeroOne = MathUtils::RangeMap(topSpeedStat, Stats::MIN_LEVEL, Stats::MAX_LEVEL, 0.0f, 1.0f);
-    topSpeedStatZeroOne = MathUtils::SmoothStep(topSpeedStatZeroOne);
-    float topSpeedStatAdjusted = MathUtils::RangeMap(topSpeedStatZeroOne, 0.0f, 1.0f, Stats::MIN_SPEED_VALUE, Stats::MAX_SPEED_VALUE);
-    return topSpeedStatAdjusted;
+    return StatCurves::Evaluate(StatCurves::TOP_SPEED_CURVE, GetTopSpeedStat());
 }
 
 //-----------------------------------------------------------------------------------
 float Entity::CalculateAccelerationValue()
 {
-    float accelerationStat = GetAccelerationStat();
-    float accelerationStatZeroOne = MathUtils::RangeMap(accelerationStat, Stats::MIN_LEVEL, Stats::MAX_LEVEL, 0.0f, 1.0f);
-    accelerationStatZeroOne = MathUtils::SmoothStop2(accelerationStatZeroOne);
-    float accelerationStatAdjusted = MathUtils::RangeMap(accelerationStatZeroOne, 0.0f, 1.0f, Stats::MIN_ACCELERATION_VALUE, Stats::MAX_ACCELERATION_VALUE);
-    return accelerationStatAdjusted;
+    return StatCurves::Evaluate(StatCurves::ACCELERATION_CURVE, GetAccelerationStat());
 }
 
 //-----------------------------------------------------------------------------------
 float Entity::CalculateHandlingValue()
 {
-    float handlingStat = GetHandlingStat();
-    float handlingStatZeroOne = MathUtils::RangeMap(handlingStat, Stats::MIN_LEVEL, Stats::MAX_LEVEL, 0.0f, 1.0f);
-    handlingStatZeroOne = MathUtils::SmoothStop2(handlingStatZeroOne);
-    float handlingStatAdjusted = MathUtils::RangeMap(handlingStatZeroOne, 0.0f, 1.0f, Stats::MIN_HANDLING_VALUE, Stats::MAX_HANDLING_VALUE);
-    return handlingStatAdjusted;
+    return StatCurves::Evaluate(StatCurves::HANDLING_CURVE, GetHandlingStat());
 }
 
 //-----------------------------------------------------------------------------------
 float Entity::CalculateBrakingValue()
 {
-    float brakingStat = GetBrakingStat();
-    float brakingStatZeroOne = MathUtils::RangeMap(brakingStat, Stats::MIN_LEVEL, Stats::MAX_LEVEL, 0.0f, 1.0f);
-    brakingStatZeroOne = MathUtils::SmoothStop2(brakingStatZeroOne);
-    float brakingStatAdjusted = MathUtils::RangeMap(brakingStatZeroOne, 0.0f, 1.0f, Stats::MIN_BRAKING_VALUE, Stats::MAX_BRAKING_VALUE);
-    return brakingStatAdjusted;
+    return StatCurves::Evaluate(StatCurves::BRAKING_CURVE, GetBrakingStat());
 }
 
 //-----------------------------------------------------------------------------------
 float Entity::CalculateDamageValue()
 {
-    float statValue = GetDamageStat();
-    float statZeroToOne = MathUtils::RangeMap(statValue, Stats::MIN_LEVEL, Stats::MAX_LEVEL, 0.0f, 1.0f);
-    statZeroToOne = MathUtils::SmoothStop2(statZeroToOne);
-    float adjustedStat = MathUtils::RangeMap(statZeroToOne, 0.0f, 1.0f, Stats::MIN_DAMAGE_VALUE, Stats::MAX_DAMAGE_VALUE);
-    return adjustedStat;
+    return StatCurves::Evaluate(StatCurves::DAMAGE_CURVE, GetDamageStat());
 }
 
 //-----------------------------------------------------------------------------------
 float Entity::CalculateShieldDisruptionValue()
 {
-    float statValue = GetShieldDisruptionStat();
-    float statZeroToOne = MathUtils::RangeMap(statValue, Stats::MIN_LEVEL, Stats::MAX_LEVEL, 0.0f, 1.0f);
-    statZeroToOne = MathUtils::SmoothStop2(statZeroToOne);
-    float adjustedStat = MathUtils::RangeMap(statZeroToOne, 0.0f, 1.0f, Stats::MIN_DISRUPTION_PERCENTAGE, Stats::MAX_DISRUPTION_PERCENTAGE);
-    return adjustedStat;
+    return StatCurves::Evaluate(StatCurves::SHIELD_DISRUPTION_CURVE, GetShieldDisruptionStat());
 }
 
 //-----------------------------------------------------------------------------------
 float Entity::CalculateShotHomingValue()
 {
-    float statValue = GetShotHomingStat();
-    float statZeroToOne = MathUtils::RangeMap(statValue, Stats::MIN_LEVEL, Stats::MAX_LEVEL, 0.0f, 1.0f);
-    statZeroToOne = MathUtils::SmoothStop2(statZeroToOne);
-    float adjustedStat = MathUtils::RangeMap(statZeroToOne, 0.0f, 1.0f, Stats::MIN_SHOT_HOMING_VALUE, Stats::MAX_SHOT_HOMING_VALUE);
-    return adjustedStat;
+    return StatCurves::Evaluate(StatCurves::SHOT_HOMING_CURVE, GetShotHomingStat());
 }
 
 //-----------------------------------------------------------------------------------
 float Entity::CalculateRateOfFireValue()
 {
-    float statValue = GetRateOfFireStat();
-    float statZeroToOne = MathUtils::RangeMap(statValue, Stats::MIN_LEVEL, Stats::MAX_LEVEL, 0.0f, 1.0f);
-    statZeroToOne = MathUtils::SmoothStop2(statZeroToOne);
-    float adjustedStat = MathUtils::RangeMap(statZeroToOne, 0.0f, 1.0f, Stats::MIN_RATE_OF_FIRE, Stats::MAX_RATE_OF_FIRE);
-    return adjustedStat;
+    return StatCurves::Evaluate(StatCurves::RATE_OF_FIRE_CURVE, GetRateOfFireStat());
 }
 
 //-----------------------------------------------------------------------------------
 float Entity::CalculateHpValue()
 {
-    float statValue = GetHpStat();
-    float statZeroToOne = MathUtils::RangeMap(statValue, Stats::MIN_LEVEL, Stats::MAX_LEVEL, 0.0f, 1.0f);
-    statZeroToOne = MathUtils::SmoothStep(statZeroToOne);
-    float adjustedStat = MathUtils::RangeMap(statZeroToOne, 0.0f, 1.0f, Stats::MIN_HP_VALUE, Stats::MAX_HP_VALUE);
-    return adjustedStat;
+    return StatCurves::Evaluate(StatCurves::HP_CURVE, GetHpStat());
 }
 
 //-----------------------------------------------------------------------------------
 float Entity::CalculateShieldCapacityValue()
 {
-    float statValue = GetShieldCapacityStat();
-    float statZeroToOne = MathUtils::RangeMap(statValue, Stats::MIN_LEVEL, Stats::MAX_LEVEL, 0.0f, 1.0f);
-    statZeroToOne = MathUtils::SmoothStep(statZeroToOne);
-    float adjustedStat = MathUtils::RangeMap(statZeroToOne, 0.0f, 1.0f, Stats::MIN_CAPACITY_VALUE, Stats::MAX_CAPACITY_VALUE);
-    return adjustedStat;
+    return StatCurves::Evaluate(StatCurves::SHIELD_CAPACITY_CURVE, GetShieldCapacityStat());
 }
 
 //-----------------------------------------------------------------------------------
 //This metric is in shield hitpoints per second.
 float Entity::CalculateShieldRegenValue()
 {
-    float statValue = GetShieldRegenStat();
-    float statZeroToOne = MathUtils::RangeMap(statValue, Stats::MIN_LEVEL, Stats::MAX_LEVEL, 0.0f, 1.0f);
-    statZeroToOne = MathUtils::SmoothStop2(statZeroToOne);
-    float adjustedStat = MathUtils::RangeMap(statZeroToOne, 0.0f, 1.0f, Stats::MIN_REGEN_RATE, Stats::MAX_REGEN_RATE);
-    return adjustedStat;
+    return StatCurves::Evaluate(StatCurves::SHIELD_REGEN_CURVE, GetShieldRegenStat());
 }
 
 //-----------------------------------------------------------------------------------
 float Entity::CalculateShotDeflectionValue()
 {
-    float statValue = GetShotDeflectionStat();
-    float statZeroToOne = MathUtils::RangeMap(statValue, Stats::MIN_LEVEL, Stats::MAX_LEVEL, 0.0f, 1.0f);
-    statZeroToOne = MathUtils::SmoothStop2(statZeroToOne);
-    float adjustedStat = MathUtils::RangeMap(statZeroToOne, 0.0f, 1.0f, Stats::MIN_DEFLECTION_VALUE, Stats::MAX_DEFLECTION_VALUE);
-    return adjustedStat;
+    return StatCurves::Evaluate(StatCurves::SHOT_DEFLECTION_CURVE, GetShotDeflectionStat());
 }
 
 //-----------------------------------------------------------------------------------
 void Entity::DeleteInventory()
 {
-    unsigned int inventorySize = m_inventory.size();
+    if (!m_loadout)
+    {
+        return;
+    }
+    std::vector<Item*>& inventory = m_loadout->m_inventory;
+    unsigned int inventorySize = inventory.size();
     for (unsigned int i = 0; i < inventorySize; ++i)
     {
-        if (m_inventory[i])
+        if (inventory[i])
         {
-            delete m_inventory[i];
-            m_inventory[i] = nullptr;
+            delete inventory[i];
+            inventory[i] = nullptr;
         }
     }
 }
@@ -510,29 +554,38 @@ void Entity::DeleteInventory()
 //-----------------------------------------------------------------------------------
 void Entity::DropInventory()
 {
-    unsigned int inventorySize = m_inventory.size();
+    if (!m_loadout)
+    {
+        return;
+    }
+    std::vector<Item*>& inventory = m_loadout->m_inventory;
+    unsigned int inventorySize = inventory.size();
     for (unsigned int i = 0; i < inventorySize; ++i)
     {
         //This transfers ownership of the item to the pickup.
-        TheGame::instance->m_currentGameMode->SpawnPickup(m_inventory[i], GetPosition());
-        m_inventory[i] = nullptr;
+        TheGame::instance->m_currentGameMode->SpawnPickup(inventory[i], GetPosition());
+        inventory[i] = nullptr;
     }
 }
 
 //-----------------------------------------------------------------------------------
 void Entity::SetShieldHealth(float newShieldValue)
 {
-    newShieldValue = Clamp<float>(newShieldValue, 0.0f, CalculateShieldCapacityValue());
-    if (m_currentShieldHealth != newShieldValue)
+    if (!m_loadout || !m_loadout->m_shieldSprite)
+    {
+        return;
+    }
+    newShieldValue = Clamp<float>(newShieldValue, 0.0f, GetShieldCapacityValue());
+    if (m_loadout->m_currentShieldHealth != newShieldValue)
     {
-        m_currentShieldHealth = newShieldValue;
-        if (m_currentShieldHealth > 0.0f)
+        m_loadout->m_currentShieldHealth = newShieldValue;
+        if (m_loadout->m_currentShieldHealth > 0.0f)
         {
-            m_shieldSprite->Enable();
+            m_loadout->m_shieldSprite->Enable();
         }
         else
         {
-            m_shieldSprite->Disable();
+            m_loadout->m_shieldSprite->Disable();
         }
     }
 }
@@ -540,9 +593,11 @@ void Entity::SetShieldHealth(float newShieldValue)
 //-----------------------------------------------------------------------------------
 void Entity::InitializeInventory(unsigned int inventorySize)
 {
-    m_inventory.resize(inventorySize);
+    ASSERT_OR_DIE(m_loadout, "Only entities with a loadout can carry an inventory");
+    std::vector<Item*>& inventory = m_loadout->m_inventory;
+    inventory.resize(inventorySize);
     for (unsigned int i = 0; i < inventorySize; ++i)
     {
-        m_inventory[i] = nullptr;
+        inventory[i] = nullptr;
     }
 }
\ No newline at end of file
@@ -2,26 +2,28 @@
 #include "Engine/Math/Transform2D.hpp"
 #include "Engine/Math/Vector2.hpp"
 #include "Game/Stats.hpp"
+#include "Game/Entities/CollisionCategory.hpp"
+#include "Game/Entities/EntityKind.hpp"
+#include "Game/Entities/EntityRegistry.hpp"
+#include "Game/Entities/EntityLoadout.hpp"
+#include "Game/GameModes/WorldTransformCache.hpp"
 #include <vector>
+#include <atomic>
 
 class Sprite;
 class SpriteResource;
-class Weapon;
-class ActiveEffect;
-class PassiveEffect;
-class Chassis;
 class Item;
 class GameMode;
+class WorldTransformCache;
 
 class Entity
 {
 public:
-    Entity();
+    Entity(EntityLoadout* loadout = nullptr);
     virtual ~Entity();
 
     //FUNCTIONS/////////////////////////////////////////////////////////////////////
     virtual void Update(float deltaSeconds);
-    virtual void ResolveCollision(Entity* otherEntity);
     virtual void ApplyImpulse(const Vector2& appliedAcceleration);
     virtual float TakeDamage(float damage, float disruption = 1.0f);
     virtual void Die() { m_isDead = true; SetShieldHealth(0.0f); };
@@ -34,22 +36,46 @@ public:
     virtual bool FlushParticleTrailIfExists() { return false; };
     void InitializeInventory(unsigned int inventorySize);
     void DeleteInventory();
+    void SetCollisionCategory(CollisionCategory category);
+    void SetKind(EntityKind kind);
+    void MarkTransformDirty(); //Call after moving m_transform directly instead of through SetPosition.
+
+    //CONTACTS/////////////////////////////////////////////////////////////////////
+    //ResolveContact runs once per overlapping pair: the bodies are pushed apart and contact damage is traded
+    //if either side CanPushAgainst the other, then each side applies its own one-sided effect to the other through the
+    //EntityKinds collision handler table. Each handler calls a non-virtual ResolveCollision on its concrete type.
+    //Handlers that push both entities themselves must do nothing once the overlap is gone, the other side runs too.
+    static void ResolveContact(Entity* first, Entity* second);
+    static void SeparateEntities(Entity* first, Entity* second);
+    static void ApplyContactDamage(Entity* attacker, Entity* victim);
+    virtual bool CanPushAgainst(Entity* otherEntity);
+
+    //INTERPOLATION/////////////////////////////////////////////////////////////////////
+    //Between sim steps the transform is drawn partway from the previous step's state to the current one,
+    //and put back before the next step runs.
+    void RecordPreviousSimState();
+    void ShowInterpolatedState(float alpha);
+    void RestoreSimState();
 
     //QUERIES/////////////////////////////////////////////////////////////////////
-    inline virtual bool IsPlayer() { return false; };
-    inline virtual bool IsProp() { return false; };
-    inline virtual bool IsProjectile() { return false; };
-    inline virtual bool IsPickup() { return false; };
-    inline virtual bool HasShield() { return m_currentShieldHealth > 0.0f; };
+    inline bool IsShip() const { return (m_kindFlags & SHIP_FLAG) != 0; };
+    inline bool IsPlayer() const { return (m_kindFlags & PLAYER_FLAG) != 0; };
+    inline bool IsProp() const { return (m_kindFlags & PROP_FLAG) != 0; };
+    inline bool IsProjectile() const { return (m_kindFlags & PROJECTILE_FLAG) != 0; };
+    inline bool IsPickup() const { return (m_kindFlags & PICKUP_FLAG) != 0; };
+    inline virtual bool HasShield() { return m_loadout && m_loadout->m_currentShieldHealth > 0.0f; };
     inline virtual bool IsDead() const { return m_isDead; };
     inline virtual bool IsAlive() const { return !m_isDead; };
     inline virtual bool ShowsDamageNumbers() { return true; };
-    inline virtual Vector2 GetPosition() { return m_transform.GetWorldPosition(); };
+    inline virtual bool CanUpdateInParallel() { return false; }; //Only if Update touches nothing but this entity.
+    inline Vector2 GetPosition() { return m_transformCache ? m_transformCache->GetWorldPosition(m_transformCacheIndex) : m_transform.GetWorldPosition(); };
     inline virtual float GetRotation() { return m_transform.GetWorldRotationDegrees(); };
     inline virtual Vector2 GetMuzzlePosition() { return GetPosition(); };
     virtual bool IsCollidingWith(Entity* otherEntity);
+    inline virtual void GetSweptBounds(Vector2& outCenter, float& outRadius) { outCenter = GetPosition(); outRadius = m_collisionRadius; };
     inline virtual bool CanTakeContactDamage() { return m_timeSinceLastHit > SECONDS_BETWEEN_CONTACT_HITS; };
     inline virtual const SpriteResource* GetCollisionSpriteResource() { return m_collisionSpriteResource; };
+    inline Entity* GetOwner() const { return EntityRegistry::instance->Resolve(m_owner); }; //Null once the owner is deleted.
 
     //STAT FUNCTIONS/////////////////////////////////////////////////////////////////////
     virtual float GetTopSpeedStat();
@@ -79,39 +105,74 @@ public:
     virtual float CalculateShieldRegenValue();
     virtual float CalculateShotDeflectionValue();
 
+    //CACHED STAT VALUES/////////////////////////////////////////////////////////////////////
+    //The Calculate*Value results, only recomputed after InvalidateStatValues. Call that whenever base stats,
+    //equipment, powerups or an item's bonuses change. Entities without a loadout have nothing to cache and evaluate directly.
+    const Stats& GetStatValues();
+    inline void InvalidateStatValues() { if (m_loadout) { m_loadout->m_areStatValuesDirty = true; } };
+    void RecalculateStatValues(Stats& outValues);
+    inline float GetTopSpeedValue() { return m_loadout ? GetStatValues().topSpeed : CalculateTopSpeedValue(); };
+    inline float GetAccelerationValue() { return m_loadout ? GetStatValues().acceleration : CalculateAccelerationValue(); };
+    inline float GetHandlingValue() { return m_loadout ? GetStatValues().handling : CalculateHandlingValue(); };
+    inline float GetBrakingValue() { return m_loadout ? GetStatValues().braking : CalculateBrakingValue(); };
+    inline float GetDamageValue() { return m_loadout ? GetStatValues().damage : CalculateDamageValue(); };
+    inline float GetShieldDisruptionValue() { return m_loadout ? GetStatValues().shieldDisruption : CalculateShieldDisruptionValue(); };
+    inline float GetShotHomingValue() { return m_loadout ? GetStatValues().shotHoming : CalculateShotHomingValue(); };
+    inline float GetRateOfFireValue() { return m_loadout ? GetStatValues().rateOfFire : CalculateRateOfFireValue(); };
+    inline float GetHpValue() { return m_loadout ? GetStatValues().hp : CalculateHpValue(); };
+    inline float GetShieldCapacityValue() { return m_loadout ? GetStatValues().shieldCapacity : CalculateShieldCapacityValue(); };
+    inline float GetShieldRegenValue() { return m_loadout ? GetStatValues().shieldRegen : CalculateShieldRegenValue(); };
+    inline float GetShotDeflectionValue() { return m_loadout ? GetStatValues().shotDeflection : CalculateShotDeflectionValue(); };
+
     //STATIC VARIABLES/////////////////////////////////////////////////////////////////////
     static Vector2 SHIELD_SCALE_FUDGE_VALUE;
     static constexpr float SECONDS_BETWEEN_CONTACT_HITS = 1.0f / 16.0f;
+    static constexpr float MAX_INTERPOLATION_DISTANCE = 2.0f;
+    static std::atomic<unsigned int> s_nextEntityId;
+    static constexpr float DEFAULT_STAT_LEVEL = 6.0f;
 
     //MEMBER VARIABLES/////////////////////////////////////////////////////////////////////
-    Stats m_baseStats;
-    Weapon* m_weapon;
-    ActiveEffect* m_activeEffect;
-    PassiveEffect* m_passiveEffect;
-    Chassis* m_chassis;
+    EntityLoadout* m_loadout; //Null for anything that can't hold a shield or equipment.
     GameMode* m_currentGameMode = nullptr;
+    WorldTransformCache* m_transformCache = nullptr; //Set while the current game mode has this entity's world position cached.
+    unsigned int m_transformCacheIndex = 0;
+    unsigned int m_entityId; //Increases in creation order, used to order contact resolution.
+    EntityHandle m_handle; //Hold this instead of an Entity* for anything that can outlive the entity.
 
     const SpriteResource* m_collisionSpriteResource = nullptr;
     Sprite* m_sprite;
-    Sprite* m_shieldSprite;
-    Entity* m_owner;
+    EntityHandle m_owner;
     Transform2D m_transform;
     Vector2 m_velocity;
     Vector2 m_sumOfImpulses = Vector2::ZERO;
-    std::vector<Item*> m_inventory;
+    Vector2 m_previousSimPosition = Vector2::ZERO;
+    Vector2 m_simPosition = Vector2::ZERO;
+    Vector2 m_renderPosition = Vector2::ZERO;
     double m_timeLastWarped = 0.0;
     float m_currentHp;
+    float m_baseHp = DEFAULT_STAT_LEVEL; //HP stat level when there's no loadout to hold base stats.
     float m_collisionRadius;
     float m_age;
     float m_timeSinceLastHit = 0.0f;
+    float m_previousSimRotation = 0.0f;
+    float m_simRotation = 0.0f;
     float m_frictionValue;
-    float m_currentShieldHealth;
+    float m_angularVelocity = 0.0f;
     float m_mass = 1.0f;
     float m_collisionDamageAmount = 0.0f;
+    CollisionCategory m_collisionCategory = PROP_CATEGORY;
+    EntityKind m_kind = ENTITY_KIND;
+    EntityFlags m_kindFlags = 0;
+    CollisionMask m_collisionMask = 0;
     bool m_isDead = false;
     bool m_collidesWithBullets = true;
     bool m_noCollide = false;
     bool m_isInvincible = false;
     bool m_staysWithinBounds = true;
     bool m_isImmobile = false;
+    bool m_hasPreviousSimState = false;
+    bool m_isShowingInterpolatedState = false;
+    bool m_isStatic = false; //Rarely moves or scales, so the game mode keeps it in a separate, prebuilt collision grid.
+    bool m_hasSimpleKinematics = false; //Moved by the game mode's KinematicsStore instead of its own Update.
+    bool m_appliesFrictionBeforeMoving = false;
 };
\ No newline at end of file
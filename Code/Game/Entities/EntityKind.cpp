@@ -0,0 +1,106 @@
+#include "Game/Entities/EntityKind.hpp"
+#include "Game/Entities/Ship.hpp"
+#include "Game/Entities/PlayerShip.hpp"
+#include "Game/Entities/Projectiles/Projectile.hpp"
+#include "Game/Entities/Projectiles/Explosion.hpp"
+#include "Game/Entities/Props/Asteroid.hpp"
+#include "Game/Entities/Props/Nebula.hpp"
+#include "Game/Entities/Props/HealingZone.hpp"
+#include "Game/Entities/Props/BlackHole.hpp"
+#include "Game/Entities/Props/Wormhole.hpp"
+#include "Game/Entities/Pickup.hpp"
+#include "Game/Entities/MinigameEntities/Coin.hpp"
+#include "Game/Entities/MinigameEntities/OuroborosCoin.hpp"
+
+EntityFlags EntityKinds::g_kindFlags[NUM_ENTITY_KINDS];
+CollisionHandler EntityKinds::g_collisionHandlers[NUM_ENTITY_KINDS][NUM_ENTITY_KINDS];
+
+namespace
+{
+    const EntityFlags DEFAULT_FLAGS[NUM_ENTITY_KINDS] =
+    {
+        0,                              //ENTITY_KIND
+        SHIP_FLAG,                      //SHIP_KIND
+        SHIP_FLAG | PLAYER_FLAG,        //PLAYER_SHIP_KIND
+        SHIP_FLAG,                      //GRUNT_KIND
+        SHIP_FLAG,                      //BRUTE_KIND
+        SHIP_FLAG,                      //TURRET_KIND
+        PROJECTILE_FLAG,                //PROJECTILE_KIND
+        PROJECTILE_FLAG,                //LASER_KIND
+        PROJECTILE_FLAG,                //PLASMA_BALL_KIND
+        PROJECTILE_FLAG,                //MISSILE_KIND
+        PROJECTILE_FLAG,                //EXPLOSION_KIND
+        PROP_FLAG,                      //ITEM_CRATE_KIND
+        PROP_FLAG,                      //SHIP_DEBRIS_KIND
+        PROP_FLAG,                      //ASTEROID_KIND
+        PROP_FLAG,                      //NEBULA_KIND
+        PROP_FLAG,                      //HEALING_ZONE_KIND
+        PROP_FLAG,                      //BLACK_HOLE_KIND
+        PROP_FLAG,                      //WORMHOLE_KIND
+        PICKUP_FLAG,                    //PICKUP_KIND
+        PICKUP_FLAG,                    //COIN_KIND
+        PICKUP_FLAG,                    //OUROBOROS_COIN_KIND
+    };
+
+    //-----------------------------------------------------------------------------------
+    template <typename Self, typename Other>
+    void ResolveAs(Entity* self, Entity* other)
+    {
+        static_cast<Self*>(self)->ResolveCollision(static_cast<Other*>(other));
+    }
+
+    //-----------------------------------------------------------------------------------
+    void SetRow(EntityKind self, CollisionHandler handler)
+    {
+        for (int other = 0; other < NUM_ENTITY_KINDS; ++other)
+        {
+            EntityKinds::g_collisionHandlers[self][other] = handler;
+        }
+    }
+
+    //-----------------------------------------------------------------------------------
+    void SetShipColumns(EntityKind self, CollisionHandler handler)
+    {
+        for (int other = 0; other < NUM_ENTITY_KINDS; ++other)
+        {
+            if (DEFAULT_FLAGS[other] & SHIP_FLAG)
+            {
+                EntityKinds::g_collisionHandlers[self][other] = handler;
+            }
+        }
+    }
+
+    //-----------------------------------------------------------------------------------
+    bool BuildKindTables()
+    {
+        for (int kind = 0; kind < NUM_ENTITY_KINDS; ++kind)
+        {
+            EntityKinds::g_kindFlags[kind] = DEFAULT_FLAGS[kind];
+            SetRow((EntityKind)kind, nullptr);
+        }
+
+        //Projectiles, explosions and the gravity wells act on anything they touch.
+        SetRow(PROJECTILE_KIND, &ResolveAs<Projectile, Entity>);
+        SetRow(LASER_KIND, &ResolveAs<Projectile, Entity>);
+        SetRow(PLASMA_BALL_KIND, &ResolveAs<Projectile, Entity>);
+        SetRow(MISSILE_KIND, &ResolveAs<Projectile, Entity>);
+        SetRow(EXPLOSION_KIND, &ResolveAs<Explosion, Entity>);
+        SetRow(BLACK_HOLE_KIND, &ResolveAs<BlackHole, Entity>);
+        SetRow(WORMHOLE_KIND, &ResolveAs<Wormhole, Entity>);
+
+        //Nebulas hide ships and healing zones heal them.
+        SetShipColumns(NEBULA_KIND, &ResolveAs<Nebula, Ship>);
+        SetShipColumns(HEALING_ZONE_KIND, &ResolveAs<HealingZone, Ship>);
+
+        //Immobile asteroids still push out of other asteroids.
+        EntityKinds::g_collisionHandlers[ASTEROID_KIND][ASTEROID_KIND] = &ResolveAs<Asteroid, Asteroid>;
+
+        //Only players pick things up.
+        EntityKinds::g_collisionHandlers[PICKUP_KIND][PLAYER_SHIP_KIND] = &ResolveAs<Pickup, PlayerShip>;
+        EntityKinds::g_collisionHandlers[COIN_KIND][PLAYER_SHIP_KIND] = &ResolveAs<Coin, PlayerShip>;
+        EntityKinds::g_collisionHandlers[OUROBOROS_COIN_KIND][PLAYER_SHIP_KIND] = &ResolveAs<OuroborosCoin, PlayerShip>;
+        return true;
+    }
+
+    const bool s_areKindTablesBuilt = BuildKindTables();
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+class Entity;
+
+typedef unsigned char EntityFlags;
+typedef void (*CollisionHandler)(Entity* self, Entity* other);
+
+//The concrete type of an entity, set once in its constructor so hot paths can branch on it without RTTI.
+//-----------------------------------------------------------------------------------
+enum EntityKind : unsigned char
+{
+    ENTITY_KIND = 0,
+    SHIP_KIND,
+    PLAYER_SHIP_KIND,
+    GRUNT_KIND,
+    BRUTE_KIND,
+    TURRET_KIND,
+    PROJECTILE_KIND,
+    LASER_KIND,
+    PLASMA_BALL_KIND,
+    MISSILE_KIND,
+    EXPLOSION_KIND,
+    ITEM_CRATE_KIND,
+    SHIP_DEBRIS_KIND,
+    ASTEROID_KIND,
+    NEBULA_KIND,
+    HEALING_ZONE_KIND,
+    BLACK_HOLE_KIND,
+    WORMHOLE_KIND,
+    PICKUP_KIND,
+    COIN_KIND,
+    OUROBOROS_COIN_KIND,
+    NUM_ENTITY_KINDS
+};
+
+//-----------------------------------------------------------------------------------
+enum EntityFlag : EntityFlags
+{
+    SHIP_FLAG = 1 << 0,
+    PLAYER_FLAG = 1 << 1,
+    PROJECTILE_FLAG = 1 << 2,
+    PROP_FLAG = 1 << 3,
+    PICKUP_FLAG = 1 << 4,
+};
+
+//What each kind does to the other side of a contact. handler[self][other] is the one-sided effect self applies to other,
+//or null when self doesn't react to that kind at all. Every contact runs both directions.
+//-----------------------------------------------------------------------------------
+namespace EntityKinds
+{
+    extern EntityFlags g_kindFlags[NUM_ENTITY_KINDS];
+    extern CollisionHandler g_collisionHandlers[NUM_ENTITY_KINDS][NUM_ENTITY_KINDS];
+
+    inline EntityFlags GetFlags(EntityKind kind) { return g_kindFlags[kind]; };
+    inline CollisionHandler GetCollisionHandler(EntityKind self, EntityKind other) { return g_collisionHandlers[self][other]; };
+}
@@ -0,0 +1,52 @@
+#include "Game/Entities/EntityLoadout.hpp"
+#include "Engine/Renderer/2D/Sprite.hpp"
+#include "Game/Items/Weapons/Weapon.hpp"
+#include "Game/Items/Chassis/Chassis.hpp"
+#include "Game/Items/Actives/ActiveEffect.hpp"
+#include "Game/Items/Passives/PassiveEffect.hpp"
+#include "Game/TheGame.hpp"
+#include "Engine/Math/MathUtils.hpp"
+
+//-----------------------------------------------------------------------------------
+EntityLoadout::EntityLoadout(bool hasShield)
+    : m_baseStats(6.0f)
+    , m_shieldSprite(hasShield ? new Sprite("Shield", TheGame::SHIELD_LAYER, false) : nullptr)
+{
+}
+
+//-----------------------------------------------------------------------------------
+EntityLoadout::~EntityLoadout()
+{
+    if (m_shieldSprite)
+    {
+        delete m_shieldSprite;
+    }
+    if (m_weapon)
+    {
+        delete m_weapon;
+    }
+    if (m_chassis)
+    {
+        delete m_chassis;
+    }
+    if (m_passiveEffect)
+    {
+        delete m_passiveEffect;
+    }
+    if (m_activeEffect)
+    {
+        delete m_activeEffect;
+    }
+}
+
+//Base level plus every equipped item's bonus, clamped to the valid level range.
+//-----------------------------------------------------------------------------------
+float EntityLoadout::GetTotalStat(float Stats::* stat) const
+{
+    float total = m_baseStats.*stat;
+    total += m_weapon ? m_weapon->m_statBonuses.*stat : 0.0f;
+    total += m_chassis ? m_chassis->m_statBonuses.*stat : 0.0f;
+    total += m_activeEffect ? m_activeEffect->m_statBonuses.*stat : 0.0f;
+    total += m_passiveEffect ? m_passiveEffect->m_statBonuses.*stat : 0.0f;
+    return Clamp<float>(total, Stats::MIN_LEVEL, Stats::MAX_LEVEL);
+}
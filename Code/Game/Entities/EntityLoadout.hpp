@@ -0,0 +1,36 @@
+#pragma once
+#include "Game/Stats.hpp"
+#include <vector>
+
+class Sprite;
+class Weapon;
+class ActiveEffect;
+class PassiveEffect;
+class Chassis;
+class Item;
+
+//Shield, stats and equipment for the entities that can actually use them: ships and item crates.
+//Bullets, props and pickups leave Entity::m_loadout null and skip all of it.
+//-----------------------------------------------------------------------------------
+class EntityLoadout
+{
+public:
+    //CONSTRUCTORS/////////////////////////////////////////////////////////////////////
+    EntityLoadout(bool hasShield);
+    ~EntityLoadout();
+
+    //FUNCTIONS/////////////////////////////////////////////////////////////////////
+    float GetTotalStat(float Stats::* stat) const;
+
+    //MEMBER VARIABLES/////////////////////////////////////////////////////////////////////
+    Stats m_baseStats;
+    Stats m_statValues;
+    std::vector<Item*> m_inventory;
+    Weapon* m_weapon = nullptr;
+    ActiveEffect* m_activeEffect = nullptr;
+    PassiveEffect* m_passiveEffect = nullptr;
+    Chassis* m_chassis = nullptr;
+    Sprite* m_shieldSprite = nullptr;
+    float m_currentShieldHealth = 0.0f;
+    bool m_areStatValuesDirty = true;
+};
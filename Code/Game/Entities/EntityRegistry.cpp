@@ -0,0 +1,59 @@
+#include "Game/Entities/EntityRegistry.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+
+EntityRegistry* EntityRegistry::instance = nullptr;
+constexpr unsigned int EntityRegistry::NO_SLOT;
+
+//-----------------------------------------------------------------------------------
+EntityHandle EntityRegistry::Register(Entity* entity)
+{
+    unsigned int index = NO_SLOT;
+    if (m_numFreeSlots > MIN_FREE_SLOTS)
+    {
+        index = m_firstFreeSlot;
+        m_firstFreeSlot = m_nextFreeSlots[index];
+        if (m_firstFreeSlot == NO_SLOT)
+        {
+            m_lastFreeSlot = NO_SLOT;
+        }
+        --m_numFreeSlots;
+        m_entities[index] = entity;
+    }
+    else
+    {
+        index = m_entities.size();
+        ASSERT_OR_DIE(index <= INDEX_MASK, "Ran out of entity registry slots");
+        m_entities.push_back(entity);
+        m_generations.push_back(1);
+        m_nextFreeSlots.push_back(NO_SLOT);
+    }
+    ++m_numLive;
+    return EntityHandle((m_generations[index] << INDEX_BITS) | index);
+}
+
+//-----------------------------------------------------------------------------------
+//Bumping the generation invalidates every outstanding handle to the slot. Generation 0 is skipped so no handle is ever null.
+void EntityRegistry::Unregister(EntityHandle handle)
+{
+    unsigned int index = handle.m_bits & INDEX_MASK;
+    ASSERT_OR_DIE(Resolve(handle) != nullptr, "Unregistered an entity that wasn't registered");
+    m_entities[index] = nullptr;
+    m_generations[index] = (m_generations[index] + 1) & GENERATION_MASK;
+    if (m_generations[index] == 0)
+    {
+        m_generations[index] = 1;
+    }
+
+    m_nextFreeSlots[index] = NO_SLOT;
+    if (m_lastFreeSlot == NO_SLOT)
+    {
+        m_firstFreeSlot = index;
+    }
+    else
+    {
+        m_nextFreeSlots[m_lastFreeSlot] = index;
+    }
+    m_lastFreeSlot = index;
+    ++m_numFreeSlots;
+    --m_numLive;
+}
@@ -0,0 +1,68 @@
+#pragma once
+#include <vector>
+
+class Entity;
+
+//32-bit reference to an entity that can outlive it. The low bits pick a registry slot and the high bits
+//count how many times that slot has been reused, so a handle to a deleted entity simply stops resolving.
+//-----------------------------------------------------------------------------------
+struct EntityHandle
+{
+    EntityHandle() : m_bits(0) {};
+    explicit EntityHandle(unsigned int bits) : m_bits(bits) {};
+    inline bool IsNull() const { return m_bits == 0; };
+    inline bool operator==(const EntityHandle& other) const { return m_bits == other.m_bits; };
+    inline bool operator!=(const EntityHandle& other) const { return m_bits != other.m_bits; };
+
+    unsigned int m_bits;
+};
+
+//Slot map from handles to live entities. Entities register themselves on construction and unregister on deletion,
+//which happens on the main thread; resolving is a bounds check and a generation compare.
+//-----------------------------------------------------------------------------------
+class EntityRegistry
+{
+public:
+    //CONSTRUCTORS/////////////////////////////////////////////////////////////////////
+    EntityRegistry() {};
+    ~EntityRegistry() {};
+
+    //FUNCTIONS/////////////////////////////////////////////////////////////////////
+    EntityHandle Register(Entity* entity);
+    void Unregister(EntityHandle handle);
+    inline Entity* Resolve(EntityHandle handle) const;
+    template <typename T> inline T* ResolveAs(EntityHandle handle) const { return static_cast<T*>(Resolve(handle)); };
+    inline unsigned int GetNumLiveEntities() const { return m_numLive; };
+    inline unsigned int GetNumSlots() const { return m_entities.size(); };
+
+    //STATIC VARIABLES/////////////////////////////////////////////////////////////////////
+    static EntityRegistry* instance;
+    static constexpr unsigned int INDEX_BITS = 20;
+    static constexpr unsigned int INDEX_MASK = (1 << INDEX_BITS) - 1;
+    static constexpr unsigned int GENERATION_BITS = 32 - INDEX_BITS;
+    static constexpr unsigned int GENERATION_MASK = (1 << GENERATION_BITS) - 1;
+    static constexpr unsigned int MIN_FREE_SLOTS = 1024; //Freed slots wait in line this long before reuse, so generations wrap slowly.
+    static constexpr unsigned int NO_SLOT = 0xFFFFFFFF;
+
+private:
+    //MEMBER VARIABLES/////////////////////////////////////////////////////////////////////
+    std::vector<Entity*> m_entities;
+    std::vector<unsigned int> m_generations;
+    std::vector<unsigned int> m_nextFreeSlots;
+    unsigned int m_firstFreeSlot = NO_SLOT;
+    unsigned int m_lastFreeSlot = NO_SLOT;
+    unsigned int m_numFreeSlots = 0;
+    unsigned int m_numLive = 0;
+};
+
+//-----------------------------------------------------------------------------------
+inline Entity* EntityRegistry::Resolve(EntityHandle handle) const
+{
+    unsigned int index = handle.m_bits & INDEX_MASK;
+    unsigned int generation = handle.m_bits >> INDEX_BITS;
+    if (handle.IsNull() || index >= m_entities.size() || m_generations[index] != generation)
+    {
+        return nullptr;
+    }
+    return m_entities[index];
+}
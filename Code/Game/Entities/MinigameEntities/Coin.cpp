@@ -13,8 +13,13 @@ Coin::Coin(const Vector2& position, int value /*= 0*/)
     : Entity()
     , m_value(value)
 {
+    SetKind(COIN_KIND);
     m_collidesWithBullets = false;
     m_noCollide = true;
+    SetCollisionCategory(PICKUP_CATEGORY);
+    m_hasSimpleKinematics = true;
+    m_appliesFrictionBeforeMoving = true;
+    m_frictionValue = 0.9f;
     m_sprite = new Sprite("BronzeCoin", TheGame::POWER_UP_LAYER);
     m_sprite->m_transform.SetParent(&m_transform);
 
@@ -64,8 +69,8 @@ Coin::Coin(const Vector2& position, int value /*= 0*/)
     float y = MathUtils::GetRandomIntFromZeroTo(2) == 1 ? MathUtils::GetRandomFloatFromZeroTo(1.0f) : -MathUtils::GetRandomFloatFromZeroTo(1.0f);
     SetPosition(position + Vector2(x, y));
     m_transform.SetRotationDegrees(MathUtils::GetRandomFloatFromZeroTo(15.0f));
-    m_baseStats.hp = 10.0f;
-    m_currentHp = m_baseStats.hp;
+    m_baseHp = 10.0f;
+    m_currentHp = m_baseHp;
 
     float directionDegrees = MathUtils::GetRandomFloatFromZeroTo(360.0f);
     m_velocity = Vector2::DegreesToDirection(directionDegrees) * 10.0f;
@@ -82,10 +87,6 @@ void Coin::Update(float deltaSeconds)
     const float FLASH_AGE_SECONDS = m_maxAge - 5.0f;
     Entity::Update(deltaSeconds);
 
-    m_velocity *= 0.9f;
-    Vector2 attemptedPosition = GetPosition() + (m_velocity * deltaSeconds);
-    SetPosition(attemptedPosition);
-    
     if (m_age > FLASH_AGE_SECONDS)
     {
         float alphaValue = static_cast<int>(m_age * 10.0f) % 2 == 0 ? 1.0f : 0.0f;
@@ -104,48 +105,30 @@ void Coin::Render() const
 }
 
 //-----------------------------------------------------------------------------------
-void Coin::ResolveCollision(Entity* otherEntity)
+bool Coin::CanPushAgainst(Entity* otherEntity)
 {
+    //Only push away against other Coins.
     if (m_age < 0.05f)
     {
-        return;
+        return false;
     }
+    return otherEntity->IsPickup() || (otherEntity->IsProp() && !otherEntity->m_isInvincible);
+}
 
-    //Only push away against other Coins.
-    if (otherEntity->IsPickup() || (otherEntity->IsProp() && !otherEntity->m_isInvincible))
+//-----------------------------------------------------------------------------------
+void Coin::ResolveCollision(PlayerShip* player)
+{
+    if (m_age < 0.05f || player->m_isDead)
     {
-        Vector2 myPosition = GetPosition();
-        Vector2 otherPosition = otherEntity->GetPosition();
-        Vector2 displacementFromOtherToMe = myPosition - otherPosition;
-        Vector2 directionFromOtherToMe = displacementFromOtherToMe.GetNorm();
-
-        float distanceBetweenEntities = displacementFromOtherToMe.CalculateMagnitude();
-        float sumOfRadii = m_collisionRadius + otherEntity->m_collisionRadius;
-        float overlapDistance = sumOfRadii - distanceBetweenEntities;
-        float pushDistance = overlapDistance * 0.5f;
-        Vector2 myPositionCorrection = directionFromOtherToMe * pushDistance;
-        if (!m_isImmobile)
-        {
-            SetPosition(myPosition + myPositionCorrection);
-        }
-        if (!otherEntity->m_isImmobile)
-        {
-            otherEntity->SetPosition(otherPosition - myPositionCorrection);
-        }
+        return;
     }
 
-    for (PlayerShip* player : TheGame::instance->m_players)
-    {
-        if ((Entity*)player == otherEntity && !player->m_isDead)
-        {
-            GameMode* mode = GameMode::GetCurrent();
+    GameMode* mode = GameMode::GetCurrent();
 
-            this->m_isDead = true;
-            mode->RecordPlayerPickupCoin(player, m_value);
-            mode->PlaySoundAt(AudioSystem::instance->CreateOrGetSound("Data/SFX/Pickups/coin.wav"), GetPosition());
-            ParticleSystem::PlayOneShotParticleEffect("PowerupPickup", TheGame::BACKGROUND_PARTICLES_LAYER, Transform2D(GetPosition()), nullptr, m_sprite->m_spriteResource);
+    this->m_isDead = true;
+    mode->RecordPlayerPickupCoin(player, m_value);
+    mode->PlaySoundAt(AudioSystem::instance->CreateOrGetSound("Data/SFX/Pickups/coin.wav"), GetPosition());
+    ParticleSystem::PlayOneShotParticleEffect("PowerupPickup", TheGame::BACKGROUND_PARTICLES_LAYER, Transform2D(GetPosition()), nullptr, m_sprite->m_spriteResource);
 
-            TextSplash::CreateTextSplash(Stringf("+%i", m_value), m_transform, Vector2(0.0f, 1.0f), RGBA::YELLOW);
-        }
-    }
+    TextSplash::CreateTextSplash(Stringf("+%i", m_value), m_transform, Vector2(0.0f, 1.0f), RGBA::YELLOW);
 }
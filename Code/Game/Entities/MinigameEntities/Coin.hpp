@@ -1,6 +1,7 @@
 #pragma once
 #include "Game/Entities/Entity.hpp"
 
+class PlayerShip;
 
 class Coin : public Entity
 {
@@ -12,9 +13,10 @@ public:
     //FUNCTIONS/////////////////////////////////////////////////////////////////////
     virtual void Update(float deltaSeconds);
     virtual void Render() const;
-    virtual void ResolveCollision(Entity* otherEntity) override;
-    inline virtual bool IsPickup() override { return true; };
+    void ResolveCollision(PlayerShip* player);
+    virtual bool CanPushAgainst(Entity* otherEntity) override;
     inline virtual bool ShowsDamageNumbers() { return false; };
+    inline virtual bool CanUpdateInParallel() override { return true; };
 
     //MEMBER VARIABLES/////////////////////////////////////////////////////////////////////
     static constexpr int GOLD_VALUE = 7;
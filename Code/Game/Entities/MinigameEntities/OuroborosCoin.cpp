@@ -13,8 +13,9 @@
 //-----------------------------------------------------------------------------------
 OuroborosCoin::OuroborosCoin(PlayerShip* owner, const Vector2& position, int value /*= 0*/)
     : Coin(position, value)
-    , m_owner(owner)
 {
+    SetKind(OUROBOROS_COIN_KIND);
+    m_owner = owner->m_handle;
     m_sprite->m_spriteResource = ResourceDatabase::instance->GetSpriteResource("OuroborosCoin");
     m_sprite->m_material = owner->m_sprite->m_material;
     m_velocity = Vector2::ZERO;
@@ -54,14 +55,14 @@ void OuroborosCoin::Render() const
 }
 
 //-----------------------------------------------------------------------------------
-void OuroborosCoin::ResolveCollision(Entity* otherEntity)
+void OuroborosCoin::ResolveCollision(PlayerShip* player)
 {
-    if ((PlayerShip*)otherEntity == m_owner)
+    if (player->m_handle == m_owner)
     {
         return;
     }
     else
     {
-        Coin::ResolveCollision(otherEntity);
+        Coin::ResolveCollision(player);
     }
 }
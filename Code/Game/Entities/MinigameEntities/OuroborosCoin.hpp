@@ -13,12 +13,10 @@ public:
     //FUNCTIONS/////////////////////////////////////////////////////////////////////
     virtual void Update(float deltaSeconds);
     virtual void Render() const;
-    virtual void ResolveCollision(Entity* otherEntity) override;
-    inline virtual bool IsPickup() override { return true; };
+    void ResolveCollision(PlayerShip* player);
     inline virtual bool ShowsDamageNumbers() { return false; };
 
     //MEMBER VARIABLES/////////////////////////////////////////////////////////////////////
     static constexpr int OUROBOROS_VALUE = 2;
     static constexpr int WINNER_OUROBOROS_VALUE = 5;
-    PlayerShip* m_owner;
 };
@@ -13,9 +13,14 @@ Pickup::Pickup(Item* item, const Vector2& initialPosition)
     , m_descriptionTextRenderable(new TextRenderable2D(item->m_name, Transform2D(Vector2(0.0f, 0.9f), 0.0f, Vector2::ONE, &m_transform), TheGame::ITEM_TEXT_LAYER))
     , m_equipTextRenderable(new TextRenderable2D(item->m_equipText, Transform2D(Vector2(0.0f, 0.4f), 0.0f, Vector2::ONE, &m_transform), TheGame::ITEM_TEXT_LAYER))
 {
+    SetKind(PICKUP_KIND);
     ASSERT_OR_DIE(m_item, "Attempted to create a pickup with no item!");
     m_collidesWithBullets = false;
     m_noCollide = true;
+    SetCollisionCategory(PICKUP_CATEGORY);
+    m_hasSimpleKinematics = true;
+    m_appliesFrictionBeforeMoving = true;
+    m_frictionValue = 0.9f;
     m_sprite = new Sprite("Invalid", TheGame::POWER_UP_LAYER);
     m_sprite->m_transform.SetParent(&m_transform);
     m_sprite->m_spriteResource = m_item->GetSpriteResource();
@@ -24,8 +29,8 @@ Pickup::Pickup(Item* item, const Vector2& initialPosition)
     float y = MathUtils::GetRandomIntFromZeroTo(2) == 1 ? MathUtils::GetRandomFloatFromZeroTo(1.0f) : -MathUtils::GetRandomFloatFromZeroTo(1.0f);
     SetPosition(initialPosition + Vector2(x, y));
     m_transform.SetRotationDegrees(MathUtils::GetRandomFloatFromZeroTo(15.0f));
-    m_baseStats.hp = 10.0f;
-    m_currentHp = m_baseStats.hp;
+    m_baseHp = 10.0f;
+    m_currentHp = m_baseHp;
 
     float directionDegrees = MathUtils::GetRandomFloatFromZeroTo(360.0f);
     m_velocity = Vector2::DegreesToDirection(directionDegrees) * 10.0f;
@@ -89,9 +94,6 @@ void Pickup::Update(float deltaSeconds)
 
     Vector2 newScale = m_baseScale + (Vector2(sin(m_age * 2.0f) / 4.0f) * m_baseScale);
     m_transform.SetScale(newScale);
-    m_velocity *= 0.9f;
-    Vector2 attemptedPosition = GetPosition() + (m_velocity * deltaSeconds);
-    SetPosition(attemptedPosition);
 
     m_typeTextRenderable->Disable();
     m_descriptionTextRenderable->Disable();
@@ -115,55 +117,37 @@ void Pickup::Render() const
 }
 
 //-----------------------------------------------------------------------------------
-void Pickup::ResolveCollision(Entity* otherEntity)
+bool Pickup::CanPushAgainst(Entity* otherEntity)
 {
+    //Only push away against other pickups.
     if (m_age < 0.05f)
     {
-        return;
+        return false;
     }
+    return otherEntity->IsPickup() || (otherEntity->IsProp() && !otherEntity->m_isInvincible);
+}
 
-    //Only push away against other pickups.
-    if (otherEntity->IsPickup() || (otherEntity->IsProp() && !otherEntity->m_isInvincible))
+//-----------------------------------------------------------------------------------
+void Pickup::ResolveCollision(PlayerShip* player)
+{
+    if (m_age < 0.05f || player->m_isDead || !m_item)
     {
-        Vector2 myPosition = GetPosition();
-        Vector2 otherPosition = otherEntity->GetPosition();
-        Vector2 displacementFromOtherToMe = myPosition - otherPosition;
-        Vector2 directionFromOtherToMe = displacementFromOtherToMe.GetNorm();
-
-        float distanceBetweenEntities = displacementFromOtherToMe.CalculateMagnitude();
-        float sumOfRadii = m_collisionRadius + otherEntity->m_collisionRadius;
-        float overlapDistance = sumOfRadii - distanceBetweenEntities;
-        float pushDistance = overlapDistance * 0.5f;
-        Vector2 myPositionCorrection = directionFromOtherToMe * pushDistance;
-        if (!m_isImmobile)
-        {
-            SetPosition(myPosition + myPositionCorrection);
-        }
-        if (!otherEntity->m_isImmobile)
-        {
-            otherEntity->SetPosition(otherPosition - myPositionCorrection);
-        }
+        return;
     }
 
-    for (PlayerShip* player : TheGame::instance->m_players)
+    if (player->CanPickUp(m_item))
+    {
+        player->PickUpItem(m_item);
+        m_item = nullptr;
+        this->m_isDead = true;
+    }
+    else
     {
-        if ((Entity*)player == otherEntity && !player->m_isDead && m_item)
+        if (!m_item->IsPowerUp())
         {
-            if (player->CanPickUp(m_item))
-            {
-                player->PickUpItem(m_item);
-                m_item = nullptr;
-                this->m_isDead = true;
-            }
-            else
-            {
-                if (!m_item->IsPowerUp())
-                {
-                    m_typeTextRenderable->Enable();
-                    m_descriptionTextRenderable->Enable();
-                    m_equipTextRenderable->Enable();
-                }
-            }
+            m_typeTextRenderable->Enable();
+            m_descriptionTextRenderable->Enable();
+            m_equipTextRenderable->Enable();
         }
     }
 }
@@ -3,6 +3,7 @@
 #include "Game/Entities/Entity.hpp"
 
 class TextRenderable2D;
+class PlayerShip;
 
 class Pickup : public Entity
 {
@@ -14,8 +15,8 @@ public:
     //FUNCTIONS/////////////////////////////////////////////////////////////////////
     virtual void Update(float deltaSeconds);
     virtual void Render() const;
-    virtual void ResolveCollision(Entity* otherEntity) override;
-    inline virtual bool IsPickup() override { return true; };
+    void ResolveCollision(PlayerShip* player);
+    virtual bool CanPushAgainst(Entity* otherEntity) override;
     inline virtual bool ShowsDamageNumbers() { return false; };
 
     //MEMBER VARIABLES/////////////////////////////////////////////////////////////////////
@@ -59,8 +59,10 @@ PlayerShip::PlayerShip(PlayerPilot* pilot)
     , m_paletteSwapShader(new ShaderProgram("Data/Shaders/default2D.vert", "Data/Shaders/paletteSwap2D.frag"))
     , m_cooldownShader(new ShaderProgram("Data/Shaders/noWarp2D.vert", "Data/Shaders/cooldown.frag"))
 {
+    SetKind(PLAYER_SHIP_KIND);
     m_paletteSwapShader->BindUniformBuffer("vortexInfo", TheGame::instance->m_bindingPoint);
     m_isDead = false;
+    SetCollisionCategory(PLAYER_CATEGORY);
     m_paletteSwapMaterial = new Material(m_paletteSwapShader, SpriteGameRenderer::instance->m_defaultRenderState);
     m_paletteSwapMaterial->ReplaceSampler(Renderer::instance->CreateSampler(GL_NEAREST, GL_NEAREST, GL_CLAMP, GL_CLAMP));
     m_cooldownMaterial = new Material(m_cooldownShader, SpriteGameRenderer::instance->m_defaultRenderState);
@@ -78,18 +80,18 @@ PlayerShip::PlayerShip(PlayerPilot* pilot)
     m_transform.SetScale(DEFAULT_SCALE);
     m_transform.SetPosition(Vector2(1000.0f));
 
-    m_shieldSprite->m_spriteResource = ResourceDatabase::instance->GetSpriteResource("RecolorableShield");
-    m_shieldSprite->m_material = m_sprite->m_material;
+    m_loadout->m_shieldSprite->m_spriteResource = ResourceDatabase::instance->GetSpriteResource("RecolorableShield");
+    m_loadout->m_shieldSprite->m_material = m_sprite->m_material;
     m_shipTrail->m_emitters[0]->m_materialOverride = m_sprite->m_material;
     m_shipTrail->m_emitters[0]->m_spriteOverride = ResourceDatabase::instance->GetSpriteResource("RecolorableBeamTrail");
-    //m_shieldSprite->m_tintColor = GetPlayerColor();
+    //m_loadout->m_shieldSprite->m_tintColor = GetPlayerColor();
     //m_shipTrail->m_colorOverride = GetPlayerColor();
     m_factionColor = GetPlayerColor();
     InitializeUI();
     InitializeStatGraph();
 
     CalculateCollisionRadius();
-    m_currentHp = CalculateHpValue();
+    m_currentHp = GetHpValue();
 
     if (g_nearlyInvulnerable)
     {
@@ -264,7 +266,7 @@ void PlayerShip::Update(float deltaSeconds)
     if (m_isDead)
     {
         m_shieldDownEffect->SetFloatUniform(gEffectTimeUniform, (float)GetCurrentTimeSeconds());
-        if (m_pilot->m_inputMap.FindInputValue("Respawn")->WasJustPressed() && (GameMode::GetCurrent()->m_respawnAllowed))
+        if (m_pilot->HasLatchedPress(RESPAWN_ACTION) && (GameMode::GetCurrent()->m_respawnAllowed))
         {
             Respawn();
         }
@@ -293,21 +295,21 @@ void PlayerShip::UpdatePlayerUI(float deltaSeconds)
     static const float MAX_UI_ALPHA = 1.0f;
     static const float MAX_BAR_UI_ALPHA = 0.75f;
 
-    m_currentWeaponUI->m_spriteResource = m_weapon ? m_weapon->GetSpriteResource() : ResourceDatabase::instance->GetSpriteResource("EmptyWeaponSlot");
-    m_currentActiveUI->m_spriteResource = m_activeEffect ? m_activeEffect->GetSpriteResource() : ResourceDatabase::instance->GetSpriteResource("EmptyActiveSlot");
-    m_currentChassisUI->m_spriteResource = m_chassis ? m_chassis->GetSpriteResource() : ResourceDatabase::instance->GetSpriteResource("EmptyChassisSlot");
-    m_currentPassiveUI->m_spriteResource = m_passiveEffect ? m_passiveEffect->GetSpriteResource() : ResourceDatabase::instance->GetSpriteResource("EmptyPassiveSlot");
+    m_currentWeaponUI->m_spriteResource = m_loadout->m_weapon ? m_loadout->m_weapon->GetSpriteResource() : ResourceDatabase::instance->GetSpriteResource("EmptyWeaponSlot");
+    m_currentActiveUI->m_spriteResource = m_loadout->m_activeEffect ? m_loadout->m_activeEffect->GetSpriteResource() : ResourceDatabase::instance->GetSpriteResource("EmptyActiveSlot");
+    m_currentChassisUI->m_spriteResource = m_loadout->m_chassis ? m_loadout->m_chassis->GetSpriteResource() : ResourceDatabase::instance->GetSpriteResource("EmptyChassisSlot");
+    m_currentPassiveUI->m_spriteResource = m_loadout->m_passiveEffect ? m_loadout->m_passiveEffect->GetSpriteResource() : ResourceDatabase::instance->GetSpriteResource("EmptyPassiveSlot");
 
-    m_healthText->m_text = Stringf("HP: %03i/%03i", static_cast<int>(ceil(m_currentHp)), static_cast<int>(ceil(CalculateHpValue())));
-    m_shieldText->m_text = Stringf("SH: %03i/%03i", static_cast<int>(ceil(m_currentShieldHealth)), static_cast<int>(ceil(CalculateShieldCapacityValue())));
+    m_healthText->m_text = Stringf("HP: %03i/%03i", static_cast<int>(ceil(m_currentHp)), static_cast<int>(ceil(GetHpValue())));
+    m_shieldText->m_text = Stringf("SH: %03i/%03i", static_cast<int>(ceil(m_loadout->m_currentShieldHealth)), static_cast<int>(ceil(GetShieldCapacityValue())));
     m_tpText->m_text = Stringf("TP: %2.2f%s", m_warpFreebieActive.m_energy * 100.0f, "%");
     m_tpText->m_color = m_warpFreebieActive.m_energy > m_warpFreebieActive.m_costToActivate ? RGBA::WHITE : RGBA::RED;
     m_scoreText->m_text = Stringf("LVL: %03i", m_powerupStatModifiers.GetTotalNumberOfDroppablePowerUps());
 
-    if (m_activeEffect)
+    if (m_loadout->m_activeEffect)
     {
-        m_cooldownMaterial->SetFloatUniform(gPercentageUniform, m_activeEffect->m_energy);
-        m_cooldownMaterial->SetFloatUniform(gPercentagePerUseUniform, m_activeEffect->m_costToActivate);
+        m_cooldownMaterial->SetFloatUniform(gPercentageUniform, m_loadout->m_activeEffect->m_energy);
+        m_cooldownMaterial->SetFloatUniform(gPercentagePerUseUniform, m_loadout->m_activeEffect->m_costToActivate);
     }
     else
     {
@@ -345,21 +347,21 @@ void PlayerShip::UpdatePlayerUI(float deltaSeconds)
 //-----------------------------------------------------------------------------------
 void PlayerShip::UpdateEquips(float deltaSeconds)
 {
-    if (m_passiveEffect)
+    if (m_loadout->m_passiveEffect)
     {
-        m_passiveEffect->Update(deltaSeconds);
+        m_loadout->m_passiveEffect->Update(deltaSeconds);
     }
-    if (m_activeEffect)
+    if (m_loadout->m_activeEffect)
     {
-        if (m_pilot->m_inputMap.WasJustPressed("Activate") && IsAlive())
+        if (m_pilot->HasLatchedPress(ACTIVATE_ACTION) && IsAlive())
         {
             NamedProperties props;
             props.Set<Ship*>("ShipPtr", (Ship*)this);
-            m_activeEffect->Activate(props);
+            m_loadout->m_activeEffect->Activate(props);
         }
-        m_activeEffect->Update(deltaSeconds);
+        m_loadout->m_activeEffect->Update(deltaSeconds);
     }
-    if (m_pilot->m_inputMap.WasJustPressed("Warp") && IsAlive())
+    if (m_pilot->HasLatchedPress(WARP_ACTION) && IsAlive())
     {
         NamedProperties props;
         props.Set<Ship*>("ShipPtr", (Ship*)this);
@@ -413,17 +415,11 @@ void PlayerShip::ShowUI()
     m_shieldBar->Enable();
 }
 
-//-----------------------------------------------------------------------------------
-void PlayerShip::ResolveCollision(Entity* otherEntity)
-{
-    Ship::ResolveCollision(otherEntity);
-}
-
 //-----------------------------------------------------------------------------------
 float PlayerShip::TakeDamage(float damage, float disruption /*= 1.0f*/)
 {
     bool hadShield = HasShield();
-    float ratioOfDamage = damage / CalculateHpValue();
+    float ratioOfDamage = damage / GetHpValue();
     float returnValue = Ship::TakeDamage(damage, disruption);
 
     if (!HasShield())
@@ -435,7 +431,7 @@ float PlayerShip::TakeDamage(float damage, float disruption /*= 1.0f*/)
         ratioOfDamage *= 4.0f;
         ratioOfDamage = Clamp(ratioOfDamage, 0.0f, 1.0f);
         m_pilot->LightRumble(ratioOfDamage, 0.25f);
-        m_healthBar->SetPercentageFilled(m_currentHp / CalculateHpValue());
+        m_healthBar->SetPercentageFilled(m_currentHp / GetHpValue());
     }
     m_pilot->HeavyRumble(ratioOfDamage, 0.25f);
 
@@ -446,21 +442,21 @@ float PlayerShip::TakeDamage(float damage, float disruption /*= 1.0f*/)
 void PlayerShip::Drain(float drainValue)
 {
     Ship::Drain(drainValue);
-    m_healthBar->SetPercentageFilled(m_currentHp / CalculateHpValue());
+    m_healthBar->SetPercentageFilled(m_currentHp / GetHpValue());
 }
 
 //-----------------------------------------------------------------------------------
 void PlayerShip::Heal(float healValue /*= 99999999.0f*/)
 {
     Ship::Heal(healValue);
-    m_healthBar->SetPercentageFilled(m_currentHp / CalculateHpValue());
+    m_healthBar->SetPercentageFilled(m_currentHp / GetHpValue());
 }
 
 //-----------------------------------------------------------------------------------
 void PlayerShip::SetShieldHealth(float newShieldValue /*= 99999999.0f*/)
 {
     Ship::SetShieldHealth(newShieldValue);
-    m_shieldBar->SetPercentageFilled(m_currentShieldHealth / CalculateShieldCapacityValue());
+    m_shieldBar->SetPercentageFilled(m_loadout->m_currentShieldHealth / GetShieldCapacityValue());
 }
 
 //-----------------------------------------------------------------------------------
@@ -500,9 +496,9 @@ void PlayerShip::Respawn()
     m_teleportBar->SetPercentageFilled(1.0f);
     m_warpFreebieActive.m_energy = 1.0f;
     m_shieldBar->SetPercentageFilled(1.0f);
-    if (m_activeEffect)
+    if (m_loadout->m_activeEffect)
     {
-        m_activeEffect->m_energy = 1.0f;
+        m_loadout->m_activeEffect->m_energy = 1.0f;
     }
 }
 
@@ -520,21 +516,21 @@ void PlayerShip::DropPowerupsAndEquipment()
     switch (randomNumber)
     {
     case 0:
-        if (m_activeEffect)
+        if (m_loadout->m_activeEffect)
         {
             EjectActive();
             powerUpPercentageDropped /= 2.0f;
         }
         break;
     case 1:
-        if (m_passiveEffect)
+        if (m_loadout->m_passiveEffect)
         {
             EjectPassive();
             powerUpPercentageDropped /= 2.0f;
         }
         break;
     case 2:
-        if (m_weapon)
+        if (m_loadout->m_weapon)
         {
             EjectWeapon();
             powerUpPercentageDropped /= 2.0f;
@@ -546,11 +542,12 @@ void PlayerShip::DropPowerupsAndEquipment()
     }
 
     //No matter what, the chassis gets destroyed. Bye bye! ;D
-    if (m_chassis)
+    if (m_loadout->m_chassis)
     {
-        m_chassis->Deactivate(NamedProperties::NONE);
-        delete m_chassis;
-        m_chassis = nullptr;
+        m_loadout->m_chassis->Deactivate(NamedProperties::NONE);
+        delete m_loadout->m_chassis;
+        m_loadout->m_chassis = nullptr;
+        InvalidateStatValues();
         m_sprite->m_spriteResource = ResourceDatabase::instance->GetSpriteResource("DefaultChassis");
     }
 
@@ -577,52 +574,57 @@ void PlayerShip::DropRandomPowerup()
 
     TheGame::instance->m_currentGameMode->SpawnPickup(new PowerUp(type), m_transform.GetWorldPosition());
     *statValue -= 1.0f;
+    InvalidateStatValues();
 }
 
 //-----------------------------------------------------------------------------------
 void PlayerShip::EjectWeapon()
 {
-    if (m_weapon)
+    if (m_loadout->m_weapon)
     {
-        TheGame::instance->m_currentGameMode->SpawnPickup(m_weapon, m_transform.GetWorldPosition() - (Vector2::DegreesToDirection(-m_transform.GetWorldRotationDegrees()) * 0.5f));
-        m_weapon = nullptr;
+        TheGame::instance->m_currentGameMode->SpawnPickup(m_loadout->m_weapon, m_transform.GetWorldPosition() - (Vector2::DegreesToDirection(-m_transform.GetWorldRotationDegrees()) * 0.5f));
+        m_loadout->m_weapon = nullptr;
+        InvalidateStatValues();
     }
 }
 
 //-----------------------------------------------------------------------------------
 void PlayerShip::EjectChassis()
 {
-    if (m_chassis)
+    if (m_loadout->m_chassis)
     {
-        m_chassis->Deactivate(NamedProperties::NONE);
-        TheGame::instance->m_currentGameMode->SpawnPickup(m_chassis, m_transform.GetWorldPosition() - (Vector2::DegreesToDirection(-m_transform.GetWorldRotationDegrees()) * 0.5f));
-        m_chassis = nullptr;
+        m_loadout->m_chassis->Deactivate(NamedProperties::NONE);
+        TheGame::instance->m_currentGameMode->SpawnPickup(m_loadout->m_chassis, m_transform.GetWorldPosition() - (Vector2::DegreesToDirection(-m_transform.GetWorldRotationDegrees()) * 0.5f));
+        m_loadout->m_chassis = nullptr;
         m_sprite->m_spriteResource = ResourceDatabase::instance->GetSpriteResource("DefaultChassis");
+        InvalidateStatValues();
     }
 }
 
 //-----------------------------------------------------------------------------------
 void PlayerShip::EjectActive()
 {
-    if (m_activeEffect)
+    if (m_loadout->m_activeEffect)
     {
-        if (m_activeEffect->IsActive())
+        if (m_loadout->m_activeEffect->IsActive())
         {
-            m_activeEffect->Deactivate(NamedProperties::NONE);
+            m_loadout->m_activeEffect->Deactivate(NamedProperties::NONE);
         }
-        TheGame::instance->m_currentGameMode->SpawnPickup(m_activeEffect, m_transform.GetWorldPosition() - (Vector2::DegreesToDirection(-m_transform.GetWorldRotationDegrees()) * 0.5f));
-        m_activeEffect = nullptr;
+        TheGame::instance->m_currentGameMode->SpawnPickup(m_loadout->m_activeEffect, m_transform.GetWorldPosition() - (Vector2::DegreesToDirection(-m_transform.GetWorldRotationDegrees()) * 0.5f));
+        m_loadout->m_activeEffect = nullptr;
+        InvalidateStatValues();
     }
 }
 
 //-----------------------------------------------------------------------------------
 void PlayerShip::EjectPassive()
 {
-    if (m_passiveEffect)
+    if (m_loadout->m_passiveEffect)
     {
-        m_passiveEffect->Deactivate(NamedProperties::NONE);
-        TheGame::instance->m_currentGameMode->SpawnPickup(m_passiveEffect, m_transform.GetWorldPosition() - (Vector2::DegreesToDirection(-m_transform.GetWorldRotationDegrees()) * 0.5f));
-        m_passiveEffect = nullptr;
+        m_loadout->m_passiveEffect->Deactivate(NamedProperties::NONE);
+        TheGame::instance->m_currentGameMode->SpawnPickup(m_loadout->m_passiveEffect, m_transform.GetWorldPosition() - (Vector2::DegreesToDirection(-m_transform.GetWorldRotationDegrees()) * 0.5f));
+        m_loadout->m_passiveEffect = nullptr;
+        InvalidateStatValues();
     }
 }
 
@@ -633,18 +635,22 @@ void PlayerShip::DebugUpdate(float deltaSeconds)
     if (InputSystem::instance->WasKeyJustPressed('1'))
     {
         m_powerupStatModifiers = Stats(-5.0f);
+        InvalidateStatValues();
     }
     else if (InputSystem::instance->WasKeyJustPressed('2'))
     {
         m_powerupStatModifiers = Stats(0.0f);
+        InvalidateStatValues();
     }
     else if (InputSystem::instance->WasKeyJustPressed('3'))
     {
         m_powerupStatModifiers = Stats(20.0f);
+        InvalidateStatValues();
     }
     else if (InputSystem::instance->WasKeyJustPressed('4'))
     {
         m_powerupStatModifiers = Stats(30.0f);
+        InvalidateStatValues();
     }
 }
 
@@ -811,13 +817,13 @@ void PlayerShip::PickUpItem(Item* pickedUpItem)
 
     if (pickedUpItem->IsPowerUp())
     {
-        const float PREVIOUS_HP = CalculateHpValue();
+        const float PREVIOUS_HP = GetHpValue();
         PowerUp* powerUp = ((PowerUp*)pickedUpItem);
         powerUp->ApplyPickupEffect(this);
 
         if (powerUp->m_powerUpType == PowerUpType::HP)
         {
-            Heal(CalculateHpValue() - PREVIOUS_HP);
+            Heal(GetHpValue() - PREVIOUS_HP);
         }
 
         GameMode::GetCurrent()->PlaySoundAt(powerUp->GetPickupSFXID(), GetPosition());
@@ -830,39 +836,43 @@ void PlayerShip::PickUpItem(Item* pickedUpItem)
     else if (pickedUpItem->IsWeapon())
     {
         EjectWeapon();
-        m_weapon = (Weapon*)pickedUpItem;
+        m_loadout->m_weapon = (Weapon*)pickedUpItem;
+        InvalidateStatValues();
         TextSplash::CreateTextSplash(Stringf("%s", pickedUpItem->m_name), m_transform, velocity, RGBA::RED);
     }
     else if (pickedUpItem->IsChassis())
     {
         EjectChassis();
-        m_chassis = (Chassis*)pickedUpItem;
-        m_sprite->m_spriteResource = m_chassis->GetShipSpriteResource();
+        m_loadout->m_chassis = (Chassis*)pickedUpItem;
+        InvalidateStatValues();
+        m_sprite->m_spriteResource = m_loadout->m_chassis->GetShipSpriteResource();
         TextSplash::CreateTextSplash(Stringf("%s", pickedUpItem->m_name), m_transform, velocity, RGBA::YELLOW);
         NamedProperties props;
         props.Set<Ship*>("ShipPtr", (Ship*)this);
-        m_chassis->Activate(props);
+        m_loadout->m_chassis->Activate(props);
     }
     else if (pickedUpItem->IsPassiveEffect())
     {
-        if (m_passiveEffect)
+        if (m_loadout->m_passiveEffect)
         {
             EjectPassive();
         }
-        m_passiveEffect = (PassiveEffect*)pickedUpItem;
+        m_loadout->m_passiveEffect = (PassiveEffect*)pickedUpItem;
+        InvalidateStatValues();
         TextSplash::CreateTextSplash(Stringf("%s", pickedUpItem->m_name), m_transform, velocity, RGBA::CERULEAN);
 
         NamedProperties props;
         props.Set<Ship*>("ShipPtr", (Ship*)this);
-        m_passiveEffect->Activate(props);
+        m_loadout->m_passiveEffect->Activate(props);
     }
     else if (pickedUpItem->IsActiveEffect())
     {
-        if (m_activeEffect)
+        if (m_loadout->m_activeEffect)
         {
             EjectActive();
         }
-        m_activeEffect = (ActiveEffect*)pickedUpItem;
+        m_loadout->m_activeEffect = (ActiveEffect*)pickedUpItem;
+        InvalidateStatValues();
         TextSplash::CreateTextSplash(Stringf("%s", pickedUpItem->m_name), m_transform, velocity, RGBA::GREEN);
     }
 }
@@ -871,7 +881,7 @@ void PlayerShip::PickUpItem(Item* pickedUpItem)
 bool PlayerShip::CanPickUp(Item* item)
 {
     double currentTimeMilliseconds = GetCurrentTimeMilliseconds();
-    bool DEBUG_HACK_EJECT_FROM_ANY_BUTTON = m_pilot->m_inputMap.IsDown("EjectWeapon") || m_pilot->m_inputMap.IsDown("EjectChassis") || m_pilot->m_inputMap.IsDown("EjectPassive") || m_pilot->m_inputMap.IsDown("EjectActive");
+    bool DEBUG_HACK_EJECT_FROM_ANY_BUTTON = m_pilot->IsDown(EJECT_WEAPON_ACTION) || m_pilot->IsDown(EJECT_CHASSIS_ACTION) || m_pilot->IsDown(EJECT_PASSIVE_ACTION) || m_pilot->IsDown(EJECT_ACTIVE_ACTION);
     if (item->IsPowerUp())
     {
         PowerUp* powerUp = (PowerUp*)item;
@@ -926,19 +936,19 @@ void PlayerShip::CheckToEjectEquipment(float)
 {
     double currentTimeMilliseconds = GetCurrentTimeMilliseconds();
 
-    if (m_pilot->m_inputMap.WasJustPressed("EjectActive"))
+    if (m_pilot->HasLatchedPress(EJECT_ACTIVE_ACTION))
     {
         m_activeBeginEjectMilliseconds = currentTimeMilliseconds;
     }
-    if (m_pilot->m_inputMap.WasJustPressed("EjectPassive"))
+    if (m_pilot->HasLatchedPress(EJECT_PASSIVE_ACTION))
     {
         m_passiveBeginEjectMilliseconds = currentTimeMilliseconds;
     }
-    if (m_pilot->m_inputMap.WasJustPressed("EjectWeapon"))
+    if (m_pilot->HasLatchedPress(EJECT_WEAPON_ACTION))
     {
         m_weaponBeginEjectMilliseconds = currentTimeMilliseconds;
     }
-    if (m_pilot->m_inputMap.WasJustPressed("EjectChassis"))
+    if (m_pilot->HasLatchedPress(EJECT_CHASSIS_ACTION))
     {
         m_chassisBeginEjectMilliseconds = currentTimeMilliseconds;
     }
@@ -25,14 +25,12 @@ public:
     void UpdatePlayerUI(float deltaSeconds);
     void UpdateEquips(float deltaSeconds);
     virtual void Render() const;
-    virtual void ResolveCollision(Entity* otherEntity) override;
     virtual float TakeDamage(float damage, float disruption = 1.0f) override;
     virtual void Drain(float drainValue) override;
     virtual void Heal(float healValue = 99999999.0f) override;
     virtual void SetShieldHealth(float newShieldValue = 99999999.0f) override;
     virtual void Die() override;
     void Respawn();
-    inline virtual bool IsPlayer() { return true; }
     void DropPowerupsAndEquipment();
     void PickUpItem(Item* pickedUpItem);
     void DropRandomPowerup();
@@ -3,15 +3,21 @@
 #include "Game/TheGame.hpp"
 #include "Game/Entities/Ship.hpp"
 #include "../PlayerShip.hpp"
-#include "Missile.hpp"
 #include "Engine/Renderer/2D/ParticleSystem.hpp"
+#include "Game/ObjectPool.hpp"
 
 const float Explosion::KNOCKBACK_MAGNITUDE = 10.0f;
 
+namespace
+{
+    ObjectPool<Explosion> s_explosionPool("Explosion");
+}
+
 //-----------------------------------------------------------------------------------
-Explosion::Explosion(Entity* owner, Entity* creator, const Vector2& spawnPosition, float damage /*= 1.0f*/, float disruption /*= 0.0f*/)
+Explosion::Explosion(Entity* owner, RibbonParticleSystem* inheritedTrail, const Vector2& spawnPosition, float damage /*= 1.0f*/, float disruption /*= 0.0f*/)
     : Projectile(owner, 0.0f, damage, disruption, 0.0f)
 {
+    SetKind(EXPLOSION_KIND);
     static const SoundID explosionSound = AudioSystem::instance->CreateOrGetSound("Data/SFX/Bullets/missileExplosion.wav");
     m_sprite = new Sprite("YellowCircle", TheGame::BULLET_LAYER_BLOOM);
     m_sprite->m_tintColor.SetAlphaFloat(1.0f);
@@ -25,10 +31,9 @@ Explosion::Explosion(Entity* owner, Entity* creator, const Vector2& spawnPositio
     m_isImmobile = true;
     GameMode::GetCurrent()->PlaySoundAt(explosionSound, spawnPosition, TheGame::BULLET_VOLUME, MathUtils::GetRandomFloat(0.9f, 1.1f));
 
-    Missile* missilePtr = dynamic_cast<Missile*>(creator);
-    if (missilePtr)
+    if (inheritedTrail)
     {
-        m_particleTrail = missilePtr->m_missileTrail;
+        m_particleTrail = inheritedTrail;
         m_particleTrail->m_emitters[0]->m_transform.SetParent(&m_transform);
     }
 }
@@ -62,9 +67,8 @@ float Explosion::GetKnockbackMagnitude()
 //-----------------------------------------------------------------------------------
 void Explosion::ResolveCollision(Entity* otherEntity)
 {
-    if (otherEntity != m_owner && otherEntity->m_collidesWithBullets && !otherEntity->m_isDead)
+    if (otherEntity->m_handle != m_owner && otherEntity->m_collidesWithBullets && !otherEntity->m_isDead)
     {
-        Entity::ResolveCollision(otherEntity);
         Vector2 dispFromThisToOther = otherEntity->m_transform.GetWorldPosition() - m_transform.GetWorldPosition();
         otherEntity->ApplyImpulse(dispFromThisToOther.GetNorm() * GetKnockbackMagnitude());
     }
@@ -81,3 +85,14 @@ bool Explosion::FlushParticleTrailIfExists()
     return false;
 }
 
+//-----------------------------------------------------------------------------------
+void* Explosion::operator new(size_t size)
+{
+    return s_explosionPool.Allocate(size);
+}
+
+//-----------------------------------------------------------------------------------
+void Explosion::operator delete(void* storage)
+{
+    s_explosionPool.Free(storage);
+}
@@ -7,12 +7,16 @@ class Explosion : public Projectile
 {
 public:
     //CONSTRUCTORS/////////////////////////////////////////////////////////////////////
-    Explosion(Entity* owner, Entity* creator, const Vector2& spawnPosition, float damage = 1.0f, float disruption = 0.0f);
+    Explosion(Entity* owner, RibbonParticleSystem* inheritedTrail, const Vector2& spawnPosition, float damage = 1.0f, float disruption = 0.0f);
     virtual ~Explosion();
     virtual bool FlushParticleTrailIfExists();
     virtual void Update(float deltaSeconds) override;
     virtual float GetKnockbackMagnitude() override;
-    virtual void ResolveCollision(Entity* otherEntity) override;
+    void ResolveCollision(Entity* otherEntity);
+
+    //POOLING/////////////////////////////////////////////////////////////////////
+    static void* operator new(size_t size);
+    static void operator delete(void* storage);
 
     //MEMBER VARIABLES/////////////////////////////////////////////////////////////////////
     static const float KNOCKBACK_MAGNITUDE;
@@ -2,13 +2,20 @@
 #include "Engine/Renderer/2D/Sprite.hpp"
 #include "Game/TheGame.hpp"
 #include "Game/Entities/Ship.hpp"
+#include "Game/ObjectPool.hpp"
 
 const float Laser::KNOCKBACK_MAGNITUDE = 10.0f;
 
+namespace
+{
+    ObjectPool<Laser> s_laserPool("Laser");
+}
+
 //-----------------------------------------------------------------------------------
 Laser::Laser(Entity* owner, float degreesOffset /*= 0.0f*/, float damage /*= 1.0f*/, float disruption /*= 0.0f*/, float homing /*= 0.0f*/) 
     : Projectile(owner, degreesOffset, damage, disruption, homing)
 {
+    SetKind(LASER_KIND);
     m_sprite = new Sprite("Laser", TheGame::BULLET_LAYER_BLOOM);
     m_sprite->m_transform.SetParent(&m_transform);
     m_transform.SetScale(Vector2(1.5f));
@@ -17,12 +24,12 @@ Laser::Laser(Entity* owner, float degreesOffset /*= 0.0f*/, float damage /*= 1.0
     CalculateCollisionRadius();
     SetPosition(owner->GetMuzzlePosition());
 
-    float parentRotationDegrees = m_owner->m_transform.GetWorldRotationDegrees();
+    float parentRotationDegrees = owner->m_transform.GetWorldRotationDegrees();
     float totalRotationDegrees = parentRotationDegrees + degreesOffset;
     m_transform.SetRotationDegrees(totalRotationDegrees);
     m_muzzleDirection = Vector2::DegreesToDirection(-totalRotationDegrees, Vector2::ZERO_DEGREES_UP);
 
-    float ownerForwardSpeed = Vector2::Dot(m_muzzleDirection, m_owner->m_velocity);
+    float ownerForwardSpeed = Vector2::Dot(m_muzzleDirection, owner->m_velocity);
     ownerForwardSpeed = std::max<float>(0.0f, ownerForwardSpeed);
     float adjustedSpeed = m_speed + ownerForwardSpeed;
 
@@ -41,3 +48,15 @@ float Laser::GetKnockbackMagnitude()
 {
     return KNOCKBACK_MAGNITUDE;
 }
+
+//-----------------------------------------------------------------------------------
+void* Laser::operator new(size_t size)
+{
+    return s_laserPool.Allocate(size);
+}
+
+//-----------------------------------------------------------------------------------
+void Laser::operator delete(void* storage)
+{
+    s_laserPool.Free(storage);
+}
@@ -9,6 +9,10 @@ public:
     virtual ~Laser();
     virtual float GetKnockbackMagnitude() override;
 
+    //POOLING/////////////////////////////////////////////////////////////////////
+    static void* operator new(size_t size);
+    static void operator delete(void* storage);
+
     //MEMBER VARIABLES/////////////////////////////////////////////////////////////////////
     static const float KNOCKBACK_MAGNITUDE;
 
@@ -5,13 +5,20 @@
 #include "Game/Entities/Ship.hpp"
 #include "../PlayerShip.hpp"
 #include "Explosion.hpp"
+#include "Game/ObjectPool.hpp"
 
 const float Missile::KNOCKBACK_MAGNITUDE = 10.0f;
 
+namespace
+{
+    ObjectPool<Missile> s_missilePool("Missile");
+}
+
 //-----------------------------------------------------------------------------------
 Missile::Missile(Entity* owner, float degreesOffset, float damage, float disruption, float homing)
     : Projectile(owner, degreesOffset, damage, disruption, homing)
 {
+    SetKind(MISSILE_KIND);
     m_speed = 5.5f;
 
     m_sprite = new AnimatedSprite("Missile", "Missile1", TheGame::BULLET_LAYER);
@@ -23,9 +30,9 @@ Missile::Missile(Entity* owner, float degreesOffset, float damage, float disrupt
     CalculateCollisionRadius();
     m_missileTrail = new RibbonParticleSystem("MissileTrail", TheGame::BACKGROUND_PARTICLES_LAYER, Transform2D(), &m_transform);
     m_missileTrail->m_colorOverride = RGBA::GRAY;
-    PlayerShip* player = dynamic_cast<PlayerShip*>(m_owner);
-    if (player)
+    if (owner->IsPlayer())
     {
+        PlayerShip* player = static_cast<PlayerShip*>(owner);
         m_sprite->m_tintColor = RGBA::WHITE;
         m_missileTrail->m_colorOverride = RGBA::WHITE;
         m_missileTrail->m_emitters[0]->m_materialOverride = player->m_shipTrail->m_emitters[0]->m_materialOverride;
@@ -34,12 +41,12 @@ Missile::Missile(Entity* owner, float degreesOffset, float damage, float disrupt
     }
     SetPosition(owner->GetMuzzlePosition());
 
-    float parentRotationDegrees = m_owner->m_transform.GetWorldRotationDegrees();
+    float parentRotationDegrees = owner->m_transform.GetWorldRotationDegrees();
     float totalRotationDegrees = parentRotationDegrees + degreesOffset;
     m_transform.SetRotationDegrees(totalRotationDegrees);
     Vector2 direction = Vector2::DegreesToDirection(-totalRotationDegrees, Vector2::ZERO_DEGREES_UP);
 
-    float ownerForwardSpeed = Vector2::Dot(direction, m_owner->m_velocity);
+    float ownerForwardSpeed = Vector2::Dot(direction, owner->m_velocity);
     ownerForwardSpeed = std::max<float>(0.0f, ownerForwardSpeed);
     float adjustedSpeed = m_speed + ownerForwardSpeed;
 
@@ -55,8 +62,12 @@ Missile::~Missile()
     GameMode* gamemode = GameMode::GetCurrent();
     if (gamemode && gamemode->m_isPlaying)
     {
+        //The explosion takes the trail over explicitly, so it never reaches back into this missile.
         m_transform.RemoveChild(&m_missileTrail->m_emitters[0]->m_transform);
-        gamemode->SpawnBullet(new Explosion(m_owner, this, m_transform.GetWorldPosition(), m_damage, m_disruption));
+        Explosion* explosion = new Explosion(GetOwner(), m_missileTrail, m_transform.GetWorldPosition(), m_damage, m_disruption);
+        explosion->m_currentGameMode = m_currentGameMode;
+        m_missileTrail = nullptr;
+        gamemode->SpawnBullet(explosion);
     }
     else
     {
@@ -93,3 +104,15 @@ void Missile::Update(float deltaSeconds)
 {
     Projectile::Update(deltaSeconds);
 }
+
+//-----------------------------------------------------------------------------------
+void* Missile::operator new(size_t size)
+{
+    return s_missilePool.Allocate(size);
+}
+
+//-----------------------------------------------------------------------------------
+void Missile::operator delete(void* storage)
+{
+    s_missilePool.Free(storage);
+}
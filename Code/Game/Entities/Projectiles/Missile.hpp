@@ -14,6 +14,10 @@ public:
     virtual void LockOn() override;
     virtual void Update(float deltaSeconds) override;
 
+    //POOLING/////////////////////////////////////////////////////////////////////
+    static void* operator new(size_t size);
+    static void operator delete(void* storage);
+
     //MEMBER VARIABLES/////////////////////////////////////////////////////////////////////
     static const float KNOCKBACK_MAGNITUDE;
     RibbonParticleSystem* m_missileTrail;
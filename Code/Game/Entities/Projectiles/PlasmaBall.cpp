@@ -5,14 +5,22 @@
 #include "Engine/Renderer/2D/ParticleSystem.hpp"
 #include "Engine/Core/StringUtils.hpp"
 #include "../TextSplash.hpp"
+#include "Game/ObjectPool.hpp"
 
 const float PlasmaBall::KNOCKBACK_MAGNITUDE = 8.0f;
 const Vector2 PlasmaBall::DEFAULT_SCALE = Vector2(1.5f);
+
+namespace
+{
+    ObjectPool<PlasmaBall> s_plasmaBallPool("PlasmaBall");
+}
+
 //-----------------------------------------------------------------------------------
 PlasmaBall::PlasmaBall(Entity* owner, float degreesOffset /*= 0.0f*/, float damage /*= 1.0f*/, float disruption /*= 0.0f*/, float homing /*= 0.0f*/, MovementBehavior behavior /*= STRAIGHT*/)
     : Projectile(owner, degreesOffset, damage, disruption, homing)
     , m_behavior(behavior)
 {
+    SetKind(PLASMA_BALL_KIND);
     m_sprite = new Sprite("PlasmaBall", TheGame::BULLET_LAYER_BLOOM);
     m_sprite->m_transform.SetParent(&m_transform);
     m_transform.SetScale(DEFAULT_SCALE);
@@ -42,12 +50,12 @@ PlasmaBall::PlasmaBall(Entity* owner, float degreesOffset /*= 0.0f*/, float dama
     SetPosition(owner->GetMuzzlePosition());
     m_centralPosition = GetPosition();
 
-    float parentRotationDegrees = m_owner->m_transform.GetWorldRotationDegrees();
+    float parentRotationDegrees = owner->m_transform.GetWorldRotationDegrees();
     float totalRotationDegrees = parentRotationDegrees + degreesOffset;
     m_transform.SetRotationDegrees(totalRotationDegrees);
     m_muzzleDirection = Vector2::DegreesToDirection(-totalRotationDegrees, Vector2::ZERO_DEGREES_UP);
 
-    float ownerForwardSpeed = Vector2::Dot(m_muzzleDirection, m_owner->m_velocity);
+    float ownerForwardSpeed = Vector2::Dot(m_muzzleDirection, owner->m_velocity);
     ownerForwardSpeed = std::max<float>(0.0f, ownerForwardSpeed);
     float adjustedSpeed = m_speed + ownerForwardSpeed;
 
@@ -78,6 +86,7 @@ void PlasmaBall::Update(float deltaSeconds)
     static const float AGE_OFFSET = 1.0f;
     const float WAVE_DEGREES_PER_SECOND = (m_behavior == PlasmaBall::STRAIGHT) ? 0.0f : 540.0f;
 
+    RecordSweepStart();
     float newRotationDegrees = m_transform.GetWorldRotationDegrees() + (SPRITE_ANGULAR_VELOCITY * deltaSeconds);
     m_transform.SetRotationDegrees(newRotationDegrees);
 
@@ -114,3 +123,15 @@ float PlasmaBall::GetKnockbackMagnitude()
 {
     return KNOCKBACK_MAGNITUDE;
 }
+
+//-----------------------------------------------------------------------------------
+void* PlasmaBall::operator new(size_t size)
+{
+    return s_plasmaBallPool.Allocate(size);
+}
+
+//-----------------------------------------------------------------------------------
+void PlasmaBall::operator delete(void* storage)
+{
+    s_plasmaBallPool.Free(storage);
+}
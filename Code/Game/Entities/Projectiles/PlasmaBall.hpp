@@ -22,6 +22,10 @@ public:
     virtual bool FlushParticleTrailIfExists() override;
     virtual float GetKnockbackMagnitude() override;
 
+    //POOLING/////////////////////////////////////////////////////////////////////
+    static void* operator new(size_t size);
+    static void operator delete(void* storage);
+
     //MEMBER VARIABLES/////////////////////////////////////////////////////////////////////
     static const float KNOCKBACK_MAGNITUDE;
     static const Vector2 DEFAULT_SCALE;
@@ -16,9 +16,11 @@ Projectile::Projectile(Entity* owner, float degreesOffset /*= 0.0f*/, float dama
     , m_shotHoming(homing)
     , m_lifeSpan(1.0f)
 {
-    m_owner = owner;
+    SetKind(PROJECTILE_KIND);
+    m_owner = owner ? owner->m_handle : EntityHandle();
     m_collidesWithBullets = false;
     m_staysWithinBounds = false;
+    SetCollisionCategory(PROJECTILE_CATEGORY);
 }
 
 //-----------------------------------------------------------------------------------
@@ -29,6 +31,7 @@ Projectile::~Projectile()
 //-----------------------------------------------------------------------------------
 void Projectile::Update(float deltaSeconds)
 {
+    RecordSweepStart();
     Entity::Update(deltaSeconds);
     if (m_age < m_lifeSpan)
     {
@@ -47,31 +50,65 @@ void Projectile::Update(float deltaSeconds)
 //-----------------------------------------------------------------------------------
 void Projectile::ResolveCollision(Entity* otherEntity)
 {
-    Entity::ResolveCollision(otherEntity);
-    if (otherEntity != m_owner && otherEntity->m_collidesWithBullets && !otherEntity->m_isDead)
+    if (otherEntity->m_handle != m_owner && otherEntity->m_collidesWithBullets && !otherEntity->m_isDead)
     {
         Vector2 dispFromThisToOther = otherEntity->m_transform.GetWorldPosition() - m_transform.GetWorldPosition();
         otherEntity->ApplyImpulse(dispFromThisToOther.GetNorm() * GetKnockbackMagnitude());
 
         float damageDealt = otherEntity->TakeDamage(m_damage, m_disruption);
-        if (m_reportDPSToPlayer)
+        Entity* owner = GetOwner();
+        if (m_reportDPSToPlayer && owner)
         {
-            PlayerShip* player = dynamic_cast<PlayerShip*>(m_owner);
-            player->m_totalDamageDone += damageDealt;
+            static_cast<PlayerShip*>(owner)->m_totalDamageDone += damageDealt;
         }
         this->m_isDead = true;
         ParticleSystem::PlayOneShotParticleEffect("Collision", TheGame::BACKGROUND_PARTICLES_LAYER, Transform2D(GetPosition()), nullptr, otherEntity->GetCollisionSpriteResource());
 
-        if (otherEntity->IsDead() && otherEntity->IsPlayer() && m_owner && m_owner->IsPlayer())
+        if (otherEntity->IsDead() && otherEntity->IsPlayer() && owner && owner->IsPlayer())
         {
-            PlayerShip* player = dynamic_cast<PlayerShip*>(m_owner);
-            PlayerShip* victim = dynamic_cast<PlayerShip*>(otherEntity);
-            ASSERT_OR_DIE(player && victim, "Somehow got a player and victim to not be players.");
-            GameMode::GetCurrent()->RecordPlayerKill(player, victim);
+            GameMode::GetCurrent()->RecordPlayerKill(static_cast<PlayerShip*>(owner), static_cast<PlayerShip*>(otherEntity));
         }
     }
 }
 
+//-----------------------------------------------------------------------------------
+void Projectile::GetSweptBounds(Vector2& outCenter, float& outRadius)
+{
+    Vector2 sweep = GetPosition() - m_sweepStart;
+    outCenter = m_sweepStart + (sweep * 0.5f);
+    outRadius = m_collisionRadius + (sweep.CalculateMagnitude() * 0.5f);
+}
+
+//Earliest fraction of this step's sweep at which we touch the other entity, treating it as sitting at its current position.
+//-----------------------------------------------------------------------------------
+bool Projectile::CalculateTimeOfImpact(Entity* otherEntity, float& outTimeOfImpact)
+{
+    const float sumOfRadii = m_collisionRadius + otherEntity->m_collisionRadius;
+    Vector2 sweep = GetPosition() - m_sweepStart;
+    Vector2 startToOther = m_sweepStart - otherEntity->GetPosition();
+    float c = Vector2::Dot(startToOther, startToOther) - (sumOfRadii * sumOfRadii);
+    if (c < 0.0f)
+    {
+        outTimeOfImpact = 0.0f;
+        return true;
+    }
+
+    float a = Vector2::Dot(sweep, sweep);
+    float b = 2.0f * Vector2::Dot(startToOther, sweep);
+    float discriminant = (b * b) - (4.0f * a * c);
+    if (a <= 0.0f || b >= 0.0f || discriminant < 0.0f)
+    {
+        return false;
+    }
+    float timeOfImpact = (-b - sqrt(discriminant)) / (2.0f * a);
+    if (timeOfImpact > 1.0f)
+    {
+        return false;
+    }
+    outTimeOfImpact = timeOfImpact;
+    return true;
+}
+
 //-----------------------------------------------------------------------------------
 float Projectile::GetKnockbackMagnitude()
 {
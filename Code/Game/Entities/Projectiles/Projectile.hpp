@@ -10,11 +10,18 @@ public:
 
     //FUNCTIONS/////////////////////////////////////////////////////////////////////
     virtual void Update(float deltaSeconds);
-    virtual void ResolveCollision(Entity* otherEntity);
-    virtual inline bool IsProjectile() { return true; };
+    void ResolveCollision(Entity* otherEntity);
+    inline virtual bool CanUpdateInParallel() override { return true; };
     virtual float GetKnockbackMagnitude();
     virtual void LockOn() {};
 
+    //SWEEPS/////////////////////////////////////////////////////////////////////
+    //Bullets are tested along the segment they covered this step, so fast shots can't skip over thin targets.
+    inline void RecordSweepStart() { m_sweepStart = GetPosition(); };
+    inline Vector2 GetSweepPosition(float t) { return m_sweepStart + ((GetPosition() - m_sweepStart) * t); };
+    virtual void GetSweptBounds(Vector2& outCenter, float& outRadius) override;
+    bool CalculateTimeOfImpact(Entity* otherEntity, float& outTimeOfImpact);
+
     //MEMBER VARIABLES/////////////////////////////////////////////////////////////////////
     static const float KNOCKBACK_MAGNITUDE;
     float m_speed;
@@ -22,5 +29,6 @@ public:
     float m_disruption;
     float m_shotHoming;
     float m_lifeSpan;
+    Vector2 m_sweepStart;
     bool m_reportDPSToPlayer = false;
 };
\ No newline at end of file
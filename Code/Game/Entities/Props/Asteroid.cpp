@@ -13,8 +13,11 @@ const float Asteroid::MAX_ASTEROID_SCALE = 1.5f;
 //-----------------------------------------------------------------------------------
 Asteroid::Asteroid(const Vector2& initialPosition)
     : Entity()
-    , m_angularVelocity(MathUtils::GetRandomFloatFromZeroTo(MAX_ANGULAR_VELOCITY) - (MAX_ANGULAR_VELOCITY * 2.0f))
 {
+    SetKind(ASTEROID_KIND);
+    m_angularVelocity = MathUtils::GetRandomFloatFromZeroTo(MAX_ANGULAR_VELOCITY) - (MAX_ANGULAR_VELOCITY * 2.0f);
+    m_hasSimpleKinematics = true;
+    m_frictionValue = 0.98f;
     m_sprite = new Sprite("Asteroid", TheGame::GEOMETRY_LAYER);
     m_sprite->m_transform.SetParent(&m_transform);
     m_transform.SetScale(Vector2(MathUtils::GetRandomFloat(MIN_ASTEROID_SCALE, MAX_ASTEROID_SCALE)));
@@ -28,9 +31,10 @@ Asteroid::Asteroid(const Vector2& initialPosition)
     float blueOffset = MathUtils::GetRandomFloat(0.9f, 1.0f);
     m_sprite->m_tintColor = RGBA(redOffset, greenOffset, blueOffset, 1.0f);
 
-    m_baseStats.hp = 3.0f * m_transform.GetWorldScale().x;
+    m_baseHp = 3.0f * m_transform.GetWorldScale().x;
     Heal();
     m_isImmobile = (m_transform.GetWorldScale().x >= MIN_ASTEROID_SCALE);
+    m_isStatic = m_isImmobile;
 }
 
 //-----------------------------------------------------------------------------------
@@ -40,25 +44,27 @@ Asteroid::~Asteroid()
 }
 
 //-----------------------------------------------------------------------------------
-void Asteroid::ResolveCollision(Entity* otherEntity)
+void Asteroid::ResolveCollision(Asteroid* otherAsteroid)
 {
-    Entity::ResolveCollision(otherEntity);
-
-    //Only push away against other pickups.
-    if ((m_isImmobile || otherEntity->m_isImmobile) && (dynamic_cast<Asteroid*>(otherEntity) != nullptr))
+    //Immobile asteroids still get pushed out of other asteroids. Both sides run this, so bail once the overlap is resolved.
+    if (m_isImmobile || otherAsteroid->m_isImmobile)
     {
         Vector2 myPosition = GetPosition();
-        Vector2 otherPosition = otherEntity->GetPosition();
+        Vector2 otherPosition = otherAsteroid->GetPosition();
         Vector2 displacementFromOtherToMe = myPosition - otherPosition;
         Vector2 directionFromOtherToMe = displacementFromOtherToMe.GetNorm();
 
         float distanceBetweenEntities = displacementFromOtherToMe.CalculateMagnitude();
-        float sumOfRadii = m_collisionRadius + otherEntity->m_collisionRadius;
+        float sumOfRadii = m_collisionRadius + otherAsteroid->m_collisionRadius;
         float overlapDistance = sumOfRadii - distanceBetweenEntities;
+        if (overlapDistance <= 0.0f)
+        {
+            return;
+        }
         float pushDistance = overlapDistance * 0.5f;
         Vector2 myPositionCorrection = directionFromOtherToMe * pushDistance;
         SetPosition(myPosition + myPositionCorrection);
-        otherEntity->SetPosition(otherPosition - myPositionCorrection);
+        otherAsteroid->SetPosition(otherPosition - myPositionCorrection);
     }
 }
 
@@ -87,6 +93,7 @@ void Asteroid::Die()
             asteroid1->m_transform.SetScale(newScale);
             asteroid1->ApplyImpulse(MathUtils::GetRandomDirectionVector() * IMPULSE_SCALE);
             asteroid1->CalculateCollisionRadius();
+            asteroid1->m_isStatic = false;
 
             if (asteroid1->m_transform.GetWorldScale().x <= MIN_ASTEROID_SCALE)
             {
@@ -105,18 +112,12 @@ void Asteroid::Die()
 void Asteroid::Update(float deltaSeconds)
 {
     Entity::Update(deltaSeconds);
-    Vector2 pos = m_transform.GetWorldPosition();
-    pos += m_velocity * deltaSeconds;
-    m_velocity *= 0.98f;
-    SetPosition(pos);
-
-    float newRotationDegrees = m_transform.GetWorldRotationDegrees() + (m_angularVelocity * deltaSeconds);
-    m_transform.SetRotationDegrees(newRotationDegrees);
 }
 
 //-----------------------------------------------------------------------------------
 void Asteroid::RecalculateHP()
 {
-    m_baseStats.hp = 3.0f * m_transform.GetWorldScale().x;
+    m_baseHp = 3.0f * m_transform.GetWorldScale().x;
+    InvalidateStatValues();
     Heal();
 }
@@ -8,14 +8,13 @@ public:
     virtual ~Asteroid();
 
     virtual void Die() override;
-    virtual void ResolveCollision(Entity* otherEntity) override;
-    inline virtual bool IsProp() override { return true; };
+    void ResolveCollision(Asteroid* otherAsteroid);
+    inline virtual bool CanUpdateInParallel() override { return true; };
     inline virtual bool ShowsDamageNumbers() { return false; };
     virtual void Update(float deltaSeconds);
     void RecalculateHP();
 
     //MEMBER VARIABLES/////////////////////////////////////////////////////////////////////
-    float m_angularVelocity;
 
     //CONSTANTS/////////////////////////////////////////////////////////////////////
     static const float MAX_ANGULAR_VELOCITY;
@@ -13,8 +13,9 @@ const float BlackHole::SCALE_GROWTH_RATE = 0.1f;
 //-----------------------------------------------------------------------------------
 BlackHole::BlackHole(const Vector2& initialPosition)
     : Entity()
-    , m_angularVelocity(MathUtils::GetRandomFloatFromZeroTo(MAX_ANGULAR_VELOCITY) - (MAX_ANGULAR_VELOCITY * 2.0f))
 {
+    SetKind(BLACK_HOLE_KIND);
+    m_angularVelocity = MathUtils::GetRandomFloatFromZeroTo(MAX_ANGULAR_VELOCITY) - (MAX_ANGULAR_VELOCITY * 2.0f);
     m_sprite = new Sprite("Wormhole", TheGame::BACKGROUND_GEOMETRY_LAYER);
     m_overlaySprite = new Sprite("Wormhole", TheGame::FOREGROUND_LAYER);
     m_sprite->m_transform.SetParent(&m_transform);
@@ -31,6 +32,8 @@ BlackHole::BlackHole(const Vector2& initialPosition)
     m_noCollide = true;
     m_collidesWithBullets = false;
     m_isImmobile = true;
+    m_isStatic = true;
+    SetCollisionCategory(VORTEX_CATEGORY);
     m_vortexID = GameMode::GetCurrent()->GetNextVortexID();
 }
 
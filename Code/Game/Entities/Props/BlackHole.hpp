@@ -10,13 +10,12 @@ public:
 
     //FUNCTIONS/////////////////////////////////////////////////////////////////////
     virtual void Update(float deltaSeconds);
-    virtual void ResolveCollision(Entity* otherEntity) override;
-    inline virtual bool IsProp() override { return true; };
+    void ResolveCollision(Entity* otherEntity);
+    inline virtual bool CanUpdateInParallel() override { return true; };
     inline virtual bool ShowsDamageNumbers() { return false; };
 
     //MEMBER VARIABLES/////////////////////////////////////////////////////////////////////
     Sprite* m_overlaySprite = nullptr;
-    float m_angularVelocity;
     bool m_growsOverTime = false;
     int m_vortexID = -1;
 
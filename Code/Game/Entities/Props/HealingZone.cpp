@@ -16,9 +16,10 @@ const float HealingZone::HEAL_AMOUNT_PER_COLLISION = 0.50f;
 //-----------------------------------------------------------------------------------
 HealingZone::HealingZone(const Vector2& initialPosition)
     : Entity()
-    , m_angularVelocity(MAX_ANGULAR_VELOCITY)
     , m_remainingHealing(MAX_POINTS_OF_HEALING)
 {
+    SetKind(HEALING_ZONE_KIND);
+    m_angularVelocity = MAX_ANGULAR_VELOCITY;
     m_sprite = new Sprite("HealingZone", TheGame::FOREGROUND_LAYER);
     m_sprite->m_transform.SetParent(&m_transform);
     CalculateCollisionRadius();
@@ -27,6 +28,8 @@ HealingZone::HealingZone(const Vector2& initialPosition)
     m_isInvincible = true;
     m_noCollide = true;
     m_collidesWithBullets = false;
+    SetCollisionCategory(FIELD_CATEGORY);
+    m_isStatic = true;
 }
 
 //-----------------------------------------------------------------------------------
@@ -50,11 +53,10 @@ void HealingZone::Update(float deltaSeconds)
 }
 
 //-----------------------------------------------------------------------------------
-void HealingZone::ResolveCollision(Entity* otherEntity)
+void HealingZone::ResolveCollision(Ship* otherShip)
 {
     static SoundID healSound = AudioSystem::instance->CreateOrGetSound("Data/SFX/Hit/boop.wav");
-    Ship* otherShip = dynamic_cast<Ship*>(otherEntity);
-    if (otherShip && !otherShip->HasFullHealth())
+    if (!otherShip->HasFullHealth())
     {
         otherShip->Heal(HEAL_AMOUNT_PER_COLLISION);
         m_remainingHealing -= HEAL_AMOUNT_PER_COLLISION;
@@ -66,7 +68,7 @@ void HealingZone::ResolveCollision(Entity* otherEntity)
         
         if (otherShip->IsPlayer())
         {
-            float pitch = (otherShip->m_currentHp / otherShip->CalculateHpValue()) + 0.5f;
+            float pitch = (otherShip->m_currentHp / otherShip->GetHpValue()) + 0.5f;
             GameMode::GetCurrent()->PlaySoundAt(healSound, otherShip->GetPosition(), 0.4f, pitch);
         }
     }
@@ -1,6 +1,8 @@
 #pragma once
 #include "Game/Entities/Entity.hpp"
 
+class Ship;
+
 class HealingZone : public Entity
 {
 public:
@@ -10,12 +12,10 @@ public:
 
     //FUNCTIONS/////////////////////////////////////////////////////////////////////
     virtual void Update(float deltaSeconds);
-    virtual void ResolveCollision(Entity* otherEntity) override;
-    inline virtual bool IsProp() override { return true; };
+    void ResolveCollision(Ship* otherShip);
     inline virtual bool ShowsDamageNumbers() { return false; };
 
     //MEMBER VARIABLES/////////////////////////////////////////////////////////////////////
-    float m_angularVelocity;
     float m_remainingHealing = 0.0f;
 
     //CONSTANTS/////////////////////////////////////////////////////////////////////
@@ -15,9 +15,12 @@ const float ItemCrate::MAX_ANGULAR_VELOCITY = 15.0f;
 
 //-----------------------------------------------------------------------------------
 ItemCrate::ItemCrate(const Vector2& initialPosition) 
-    : Entity()
-    , m_angularVelocity(MathUtils::GetRandomFloatFromZeroTo(MAX_ANGULAR_VELOCITY) - (MAX_ANGULAR_VELOCITY * 2.0f))
+    : Entity(new EntityLoadout(false))
 {
+    SetKind(ITEM_CRATE_KIND);
+    m_angularVelocity = MathUtils::GetRandomFloatFromZeroTo(MAX_ANGULAR_VELOCITY) - (MAX_ANGULAR_VELOCITY * 2.0f);
+    m_hasSimpleKinematics = true;
+    m_frictionValue = 0.9f;
     m_sprite = new Sprite("ItemBox", TheGame::CRATE_LAYER);
     m_sprite->m_transform.SetParent(&m_transform);
     m_transform.SetScale(Vector2(1.0f));
@@ -42,14 +45,6 @@ ItemCrate::~ItemCrate()
 void ItemCrate::Update(float deltaSeconds)
 {
     Entity::Update(deltaSeconds);
-    Vector2 pos = m_transform.GetWorldPosition();
-    pos += m_velocity * deltaSeconds;
-    m_velocity *= 0.9f;
-    SetPosition(pos);
-
-    float newRotation = m_transform.GetWorldRotationDegrees() + m_angularVelocity * deltaSeconds;
-    Vector2 direction = Vector2::DegreesToDirection(-newRotation, Vector2::ZERO_DEGREES_UP);
-    m_transform.SetRotationDegrees(newRotation);
 }
 
 //-----------------------------------------------------------------------------------
@@ -68,30 +63,30 @@ void ItemCrate::GenerateItems()
     static const float EQUIPMENT_PERCENTAGE_CHANCE = 1.0f - ITEM_PERCENTAGE_CHANCE;
 
     //Guarantee that we have a single power up so that we can make the crate have information on what's in it.
-    m_inventory[0] = new PowerUp();
+    m_loadout->m_inventory[0] = new PowerUp();
 
-    unsigned int inventorySize = m_inventory.size();
+    unsigned int inventorySize = m_loadout->m_inventory.size();
     for (unsigned int i = 1; i < inventorySize; ++i)
     {
         if (MathUtils::GetRandomFloatFromZeroTo(1.0f) < ITEM_PERCENTAGE_CHANCE)
         {
-            m_inventory[i] = new PowerUp();
+            m_loadout->m_inventory[i] = new PowerUp();
         }
         else
         {
             switch (MathUtils::GetRandomIntFromZeroTo(4))
             {
             case 0:
-                m_inventory[i] = GetRandomWeapon();
+                m_loadout->m_inventory[i] = GetRandomWeapon();
                 break;
             case 1:
-                m_inventory[i] = GetRandomChassis();
+                m_loadout->m_inventory[i] = GetRandomChassis();
                 break;
             case 2:
-                m_inventory[i] = GetRandomActive();
+                m_loadout->m_inventory[i] = GetRandomActive();
                 break;
             case 3:
-                m_inventory[i] = GetRandomPassive();
+                m_loadout->m_inventory[i] = GetRandomPassive();
                 break;
             }
         }
@@ -101,7 +96,7 @@ void ItemCrate::GenerateItems()
 //-----------------------------------------------------------------------------------
 void ItemCrate::DecorateCrate()
 {
-    PowerUp* powerUp = dynamic_cast<PowerUp*>(m_inventory[0]);
+    PowerUp* powerUp = dynamic_cast<PowerUp*>(m_loadout->m_inventory[0]);
     ASSERT_OR_DIE(powerUp != nullptr, "First item in crate wasn't a power up, failed to decorate crate.");
 
     m_sprite->m_tintColor = PowerUp::GetPowerUpColor(powerUp->m_powerUpType);
@@ -11,13 +11,12 @@ public:
     //FUNCTIONS/////////////////////////////////////////////////////////////////////
     virtual void Update(float deltaSeconds) override;
     virtual void Die() override;
-    inline virtual bool IsProp() override { return true; };
+    inline virtual bool CanUpdateInParallel() override { return true; };
     void GenerateItems();
     void DecorateCrate();
 
     //MEMBER VARIABLES/////////////////////////////////////////////////////////////////////
     Sprite* m_itemHintSprite = nullptr;
-    float m_angularVelocity;
 
     //CONSTANTS/////////////////////////////////////////////////////////////////////
     static const float MAX_ANGULAR_VELOCITY;
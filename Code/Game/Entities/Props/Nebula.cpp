@@ -9,8 +9,9 @@ const float Nebula::MAX_ANGULAR_VELOCITY = 0.1f;
 //-----------------------------------------------------------------------------------
 Nebula::Nebula(const Vector2& initialPosition)
     : Entity()
-    , m_angularVelocity(MathUtils::GetRandomFloatFromZeroTo(MAX_ANGULAR_VELOCITY) - (MAX_ANGULAR_VELOCITY * 2.0f))
 {
+    SetKind(NEBULA_KIND);
+    m_angularVelocity = MathUtils::GetRandomFloatFromZeroTo(MAX_ANGULAR_VELOCITY) - (MAX_ANGULAR_VELOCITY * 2.0f);
     const char* spriteString = MathUtils::GetRandomIntFromZeroTo(2) == 0 ? "Nebula" : "Nebula2";
     m_sprite = new Sprite(spriteString, TheGame::FOREGROUND_LAYER);
     m_sprite->m_transform.SetParent(&m_transform);
@@ -20,6 +21,8 @@ Nebula::Nebula(const Vector2& initialPosition)
     m_isInvincible = true;
     m_noCollide = true;
     m_collidesWithBullets = false;
+    SetCollisionCategory(FIELD_CATEGORY);
+    m_isStatic = true;
 }
 
 //-----------------------------------------------------------------------------------
@@ -36,14 +39,10 @@ void Nebula::Update(float deltaSeconds)
 }
 
 //-----------------------------------------------------------------------------------
-void Nebula::ResolveCollision(Entity* otherEntity)
+void Nebula::ResolveCollision(Ship* otherShip)
 {
-    Ship* otherShip = dynamic_cast<Ship*>(otherEntity);
-    if (otherShip)
-    {
-        float distanceToCenterSquared = MathUtils::CalcDistSquaredBetweenPoints(otherShip->GetPosition(), GetPosition());
-        float radiusSquared = m_collisionRadius * m_collisionRadius;
-        float nebulaStealth = 1.0f - MathUtils::SmoothStart2(Clamp01(distanceToCenterSquared / radiusSquared));
-        otherShip->m_stealthFactor = std::max<float>(otherShip->m_stealthFactor, nebulaStealth);
-    }
+    float distanceToCenterSquared = MathUtils::CalcDistSquaredBetweenPoints(otherShip->GetPosition(), GetPosition());
+    float radiusSquared = m_collisionRadius * m_collisionRadius;
+    float nebulaStealth = 1.0f - MathUtils::SmoothStart2(Clamp01(distanceToCenterSquared / radiusSquared));
+    otherShip->m_stealthFactor = std::max<float>(otherShip->m_stealthFactor, nebulaStealth);
 }
@@ -1,6 +1,8 @@
 #pragma once
 #include "Game/Entities/Entity.hpp"
 
+class Ship;
+
 class Nebula : public Entity
 {
 public:
@@ -10,12 +12,11 @@ public:
 
     //FUNCTIONS/////////////////////////////////////////////////////////////////////
     virtual void Update(float deltaSeconds);
-    virtual void ResolveCollision(Entity* otherEntity) override;
-    inline virtual bool IsProp() override { return true; };
+    void ResolveCollision(Ship* otherShip);
+    inline virtual bool CanUpdateInParallel() override { return true; };
     inline virtual bool ShowsDamageNumbers() { return false; };
 
     //MEMBER VARIABLES/////////////////////////////////////////////////////////////////////
-    float m_angularVelocity;
 
     //CONSTANTS/////////////////////////////////////////////////////////////////////
     static const float MAX_ANGULAR_VELOCITY;
@@ -9,8 +9,11 @@
 ShipDebris::ShipDebris(const Transform2D& transform, const SpriteResource* resource, const Vector2& velocity) 
     : Entity()
 {
+    SetKind(SHIP_DEBRIS_KIND);
     m_transform = transform;
     m_velocity = velocity;
+    m_hasSimpleKinematics = true;
+    m_frictionValue = 0.95f;
     m_smokeDamage = new ParticleSystem("Smoking", TheGame::BACKGROUND_PARTICLES_LAYER, Transform2D(), &m_transform);
 
     m_sprite = new Sprite("DefaultChassis", TheGame::BACKGROUND_GEOMETRY_LAYER_ABOVE);
@@ -21,7 +24,7 @@ ShipDebris::ShipDebris(const Transform2D& transform, const SpriteResource* resou
 
     m_collisionSpriteResource = ResourceDatabase::instance->GetSpriteResource("ParticleBrown");
 
-    m_baseStats.hp = 10.0f;
+    m_baseHp = 10.0f;
     Heal();
 }
 
@@ -36,8 +39,4 @@ ShipDebris::~ShipDebris()
 void ShipDebris::Update(float deltaSeconds)
 {
     Entity::Update(deltaSeconds);
-    Vector2 pos = m_transform.GetWorldPosition();
-    pos += m_velocity * deltaSeconds;
-    m_velocity *= 0.95f;
-    SetPosition(pos);
 }
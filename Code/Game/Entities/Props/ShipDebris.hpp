@@ -12,7 +12,7 @@ public:
 
     //FUNCTIONS/////////////////////////////////////////////////////////////////////
     virtual void Update(float deltaSeconds);
-    inline virtual bool IsProp() override { return true; };
+    inline virtual bool CanUpdateInParallel() override { return true; };
     inline virtual bool ShowsDamageNumbers() { return false; };
 
     //MEMBER VARIABLES/////////////////////////////////////////////////////////////////////
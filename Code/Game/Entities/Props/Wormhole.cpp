@@ -11,8 +11,9 @@ const float Wormhole::PERCENTAGE_RADIUS_INNER_RADIUS = 0.1f;
 //-----------------------------------------------------------------------------------
 Wormhole::Wormhole(const Vector2& initialPosition)
     : Entity()
-    , m_angularVelocity(MathUtils::GetRandomFloatFromZeroTo(MAX_ANGULAR_VELOCITY) - (MAX_ANGULAR_VELOCITY * 2.0f))
 {
+    SetKind(WORMHOLE_KIND);
+    m_angularVelocity = MathUtils::GetRandomFloatFromZeroTo(MAX_ANGULAR_VELOCITY) - (MAX_ANGULAR_VELOCITY * 2.0f);
     m_sprite = new Sprite("Wormhole", TheGame::BACKGROUND_GEOMETRY_LAYER);
     m_overlaySprite = new Sprite("Wormhole", TheGame::FOREGROUND_LAYER);
     m_sprite->m_transform.SetParent(&m_transform);
@@ -27,6 +28,8 @@ Wormhole::Wormhole(const Vector2& initialPosition)
     m_noCollide = true;
     m_collidesWithBullets = false;
     m_isImmobile = true;
+    m_isStatic = true;
+    SetCollisionCategory(VORTEX_CATEGORY);
     m_vortexID = GameMode::GetCurrent()->GetNextVortexID();
 }
 
@@ -55,13 +58,15 @@ void Wormhole::ResolveCollision(Entity* otherEntity)
     Vector2 dispFromOtherToCenter = m_transform.GetWorldPosition() - otherEntity->m_transform.GetWorldPosition();
     Vector2 normDirectionTowardsCenter = dispFromOtherToCenter.GetNorm();
 
-    if ((dispFromOtherToCenter.CalculateMagnitudeSquared() < INNER_RADIUS_SQUARED) && (GetCurrentTimeSeconds() - otherEntity->m_timeLastWarped > GRACE_PERIOD_TELEPORT_SECONDS))
+    //If the other end has been deleted, this wormhole just pushes like the outer ring does.
+    Entity* linkedWormhole = EntityRegistry::instance->Resolve(m_linkedWormhole);
+    if (linkedWormhole && (dispFromOtherToCenter.CalculateMagnitudeSquared() < INNER_RADIUS_SQUARED) && (GetCurrentTimeSeconds() - otherEntity->m_timeLastWarped > GRACE_PERIOD_TELEPORT_SECONDS))
     {
         const float IMPULSE_MAGNITUDE = 2000.0f;
-        ASSERT_OR_DIE(m_linkedWormhole, "Wormhole wasn't linked to another!");
-        Vector2 otherWormholePosition = m_linkedWormhole->m_transform.GetWorldPosition();
+        Vector2 otherWormholePosition = linkedWormhole->m_transform.GetWorldPosition();
 
         otherEntity->m_transform.SetPosition(otherWormholePosition + normDirectionTowardsCenter * 1.0f);
+        otherEntity->MarkTransformDirty();
         otherEntity->ApplyImpulse(normDirectionTowardsCenter * IMPULSE_MAGNITUDE);
         otherEntity->m_timeLastWarped = GetCurrentTimeSeconds();
         otherEntity->FlushParticleTrailIfExists();
@@ -78,6 +83,6 @@ void Wormhole::ResolveCollision(Entity* otherEntity)
 //-----------------------------------------------------------------------------------
 void Wormhole::LinkWormholes(Wormhole* wormhole1, Wormhole* wormhole2)
 {
-    wormhole1->m_linkedWormhole = wormhole2;
-    wormhole2->m_linkedWormhole = wormhole1;
+    wormhole1->m_linkedWormhole = wormhole2->m_handle;
+    wormhole2->m_linkedWormhole = wormhole1->m_handle;
 }
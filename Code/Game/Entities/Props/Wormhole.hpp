@@ -10,15 +10,14 @@ public:
 
     //FUNCTIONS/////////////////////////////////////////////////////////////////////
     virtual void Update(float deltaSeconds);
-    virtual void ResolveCollision(Entity* otherEntity) override;
+    void ResolveCollision(Entity* otherEntity);
     static void LinkWormholes(Wormhole* wormhole1, Wormhole* wormhole2);
-    inline virtual bool IsProp() override { return true; };
+    inline virtual bool CanUpdateInParallel() override { return true; };
     inline virtual bool ShowsDamageNumbers() { return false; };
 
     //MEMBER VARIABLES/////////////////////////////////////////////////////////////////////
-    Wormhole* m_linkedWormhole;
+    EntityHandle m_linkedWormhole;
     Sprite* m_overlaySprite;
-    float m_angularVelocity;
     int m_vortexID;
 
     //CONSTANTS/////////////////////////////////////////////////////////////////////
@@ -14,26 +14,31 @@
 #include "Engine/Renderer/Material.hpp"
 #include "Props/ShipDebris.hpp"
 #include "Engine/Math/MathUtils.hpp"
-#include "TextSplash.hpp"
+#include "DamageNumbers.hpp"
+#include "Game/StatBlockRegistry.hpp"
 
 //-----------------------------------------------------------------------------------
 Ship::Ship(Pilot* pilot)
-    : Entity()
+    : Entity(new EntityLoadout(true))
     , m_secondsSinceLastFiredWeapon(0.0f)
     , m_pilot(pilot)
     , m_shipTrail(new RibbonParticleSystem("ShipTrail", TheGame::BACKGROUND_PARTICLES_LAYER, Transform2D(), &m_transform))
     , m_smokeDamage(new ParticleSystem("SmokeTrail", TheGame::BACKGROUND_PARTICLES_LAYER, Transform2D(), &m_transform))
+    , m_statBlockIndex(StatBlockRegistry::instance->Register(this))
 {
-    SetShieldHealth(CalculateShieldCapacityValue());
+    SetKind(SHIP_KIND);
+    SetShieldHealth(GetShieldCapacityValue());
     m_collisionSpriteResource = ResourceDatabase::instance->GetSpriteResource("Explosion");
     m_shieldCollisionSpriteResource = ResourceDatabase::instance->GetSpriteResource("ParticleGreen");
     m_smokeDamage->Disable();
-    m_shieldSprite->m_transform.IgnoreParentScale();
+    m_loadout->m_shieldSprite->m_transform.IgnoreParentScale();
+    SetCollisionCategory(SHIP_CATEGORY);
 }
 
 //-----------------------------------------------------------------------------------
 Ship::~Ship()
 {
+    StatBlockRegistry::instance->Unregister(m_statBlockIndex);
     ParticleSystem::DestroyImmediately(m_shipTrail);
     ParticleSystem::DestroyImmediately(m_smokeDamage);
 }
@@ -57,8 +62,7 @@ void Ship::Update(float deltaSeconds)
 
         m_velocity.CalculateMagnitudeSquared() < 0.1f ? m_shipTrail->Pause() : m_shipTrail->Unpause();
 
-        InputValue* suicideInput = m_pilot->m_inputMap.FindInputValue("Suicide");
-        if (suicideInput && suicideInput->WasJustPressed())
+        if (m_pilot->HasLatchedPress(SUICIDE_ACTION))
         {
             m_isDead = true;
             Die();
@@ -69,9 +73,8 @@ void Ship::Update(float deltaSeconds)
 //-----------------------------------------------------------------------------------
 void Ship::UpdateShooting()
 {
-    InputMap& input = m_pilot->m_inputMap;
-    Vector2 shootDirection = input.GetVector2("ShootRight", "ShootUp");
-    bool isShooting = input.FindInputValue("Shoot")->IsDown();
+    Vector2 shootDirection = m_pilot->GetVector2(SHOOT_RIGHT_AXIS, SHOOT_UP_AXIS);
+    bool isShooting = m_pilot->IsDown(SHOOT_ACTION);
 
     if (shootDirection.CalculateMagnitudeSquared() > DEADZONE_BEFORE_ROTATION_SQUARED)
     {
@@ -80,11 +83,11 @@ void Ship::UpdateShooting()
 
     if (isShooting && !m_lockMovement)
     {
-        if (m_weapon)
+        if (m_loadout->m_weapon)
         {
-            if (m_weapon->AttemptFire(this))
+            if (m_loadout->m_weapon->AttemptFire(this))
             {
-                ApplyImpulse(-shootDirection * m_weapon->GetKnockbackMagnitude());
+                ApplyImpulse(-shootDirection * m_loadout->m_weapon->GetKnockbackMagnitude());
             }
         }
         else
@@ -102,8 +105,8 @@ void Ship::RegenerateShield(float deltaSeconds)
 {
     if (m_timeSinceLastHit > SECONDS_BEFORE_SHIELD_REGEN_RESTARTS)
     {
-        float regenPointsThisFrame = CalculateShieldRegenValue() * deltaSeconds;
-        SetShieldHealth(m_currentShieldHealth + regenPointsThisFrame);
+        float regenPointsThisFrame = GetShieldRegenValue() * deltaSeconds;
+        SetShieldHealth(m_loadout->m_currentShieldHealth + regenPointsThisFrame);
     }
 }
 
@@ -112,7 +115,6 @@ void Ship::ApplyShotDeflection()
 {
     static const float DEADSHOT_DOT_TOLERANCE = fabs(SinDegrees(5.0f));
     const float DEFLECTION_RADIUS = 4.0f;
-    const float DEFLECTION_RADIUS_SQUARED = DEFLECTION_RADIUS * DEFLECTION_RADIUS;
     GameMode* current = GameMode::GetCurrent();
 
     if (!current)
@@ -120,33 +122,29 @@ void Ship::ApplyShotDeflection()
         return;
     }
 
-    std::vector<Entity*> nearbyEntities = current->GetEntitiesInRadiusSquared(GetPosition(), DEFLECTION_RADIUS_SQUARED);
-
-    for (Entity* entity : nearbyEntities)
+    EntityFilter filter(CollisionLayers::GetCategoryBit(PROJECTILE_CATEGORY), this);
+    current->ForEachEntityInCircle(GetPosition(), DEFLECTION_RADIUS, filter, [&](Entity* entity)
     {
-        if (entity->IsProjectile() && entity->m_owner != this)
+        Projectile* projectile = (Projectile*)entity;
+        Vector2 bulletPos = projectile->GetPosition();
+        Vector2 displacementFromBulletToShip = GetPosition() - bulletPos;
+        Vector2 velocityPerpendicular = Vector2(-projectile->m_velocity.y, projectile->m_velocity.x);
+        Vector2 displacementNormalized = displacementFromBulletToShip.GetNorm();
+        Vector2 normalizedVelocity = velocityPerpendicular.GetNorm();
+
+        float dotProduct = Vector2::Dot(displacementNormalized, normalizedVelocity);
+        if (fabs(dotProduct) > DEADSHOT_DOT_TOLERANCE)
         {
-            Projectile* projectile = (Projectile*)entity;
-            Vector2 bulletPos = projectile->GetPosition();
-            Vector2 displacementFromBulletToShip = GetPosition() - bulletPos;
-            Vector2 velocityPerpendicular = Vector2(-projectile->m_velocity.y, projectile->m_velocity.x);
-            Vector2 displacementNormalized = displacementFromBulletToShip.GetNorm();
-            Vector2 normalizedVelocity = velocityPerpendicular.GetNorm();
-
-            float dotProduct = Vector2::Dot(displacementNormalized, normalizedVelocity);
-            if (fabs(dotProduct) > DEADSHOT_DOT_TOLERANCE)
+            Vector2 resolutionDirection = dotProduct > 0 ? -normalizedVelocity : normalizedVelocity;
+            float totalShotModificationConstant = GetShotDeflectionValue() - projectile->m_shotHoming;
+            projectile->ApplyImpulse(resolutionDirection * totalShotModificationConstant);
+
+            if (totalShotModificationConstant < 0.0f)
             {
-                Vector2 resolutionDirection = dotProduct > 0 ? -normalizedVelocity : normalizedVelocity;
-                float totalShotModificationConstant = CalculateShotDeflectionValue() - projectile->m_shotHoming;
-                projectile->ApplyImpulse(resolutionDirection * totalShotModificationConstant);
-
-                if (totalShotModificationConstant < 0.0f)
-                {
-                    projectile->LockOn();
-                }
-            }  
+                projectile->LockOn();
+            }
         }
-    }
+    });
 }
 
 //-----------------------------------------------------------------------------------
@@ -154,39 +152,32 @@ void Ship::FlickerShield(float deltaSeconds)
 {
     static int index = 0;
     UNUSED(deltaSeconds);
-    float ratio = m_currentShieldHealth / CalculateShieldCapacityValue();
+    float ratio = m_loadout->m_currentShieldHealth / GetShieldCapacityValue();
     float noiseValue = Get1dNoiseNegOneToOne(++index);
     float alphaValue = Max<float>(ratio, noiseValue);
-    m_shieldSprite->m_tintColor.SetAlphaFloat(alphaValue);
+    m_loadout->m_shieldSprite->m_tintColor.SetAlphaFloat(alphaValue);
 
     float rotationThisFrame = (ANGULAR_VELOCITY * deltaSeconds) * ratio;
-    m_shieldSprite->m_transform.SetRotationDegrees(m_shieldSprite->m_transform.GetLocalRotationDegrees() + rotationThisFrame);
+    m_loadout->m_shieldSprite->m_transform.SetRotationDegrees(m_loadout->m_shieldSprite->m_transform.GetLocalRotationDegrees() + rotationThisFrame);
 }
 
 //-----------------------------------------------------------------------------------
 bool Ship::HasFullHealth()
 {
-    return m_currentHp == CalculateHpValue();
+    return m_currentHp == GetHpValue();
 }
 
 //-----------------------------------------------------------------------------------
 void Ship::HealShield(float healValue)
 {
-    m_currentShieldHealth += healValue;
-    m_currentShieldHealth = MathUtils::Clamp(m_currentShieldHealth, 0.0f, CalculateShieldCapacityValue());
-}
-
-//-----------------------------------------------------------------------------------
-void Ship::ResolveCollision(Entity* otherEntity)
-{
-    Entity::ResolveCollision(otherEntity);
+    m_loadout->m_currentShieldHealth += healValue;
+    m_loadout->m_currentShieldHealth = MathUtils::Clamp(m_loadout->m_currentShieldHealth, 0.0f, GetShieldCapacityValue());
 }
 
 //-----------------------------------------------------------------------------------
 void Ship::UpdateMotion(float deltaSeconds)
 {
-    InputMap& input = m_pilot->m_inputMap;
-    Vector2 inputDirection = input.GetVector2("Right", "Up");
+    Vector2 inputDirection = m_pilot->GetVector2(RIGHT_AXIS, UP_AXIS);
 
     if (m_lockMovement || m_isImmobile)
     {
@@ -197,24 +188,24 @@ void Ship::UpdateMotion(float deltaSeconds)
     Vector2 velocityDir = m_velocity.CalculateMagnitude() < 0.01f ? inputDirection.GetNorm() : m_velocity.GetNorm();
     Vector2 perpindicularVelocityDir(-velocityDir.y, velocityDir.x);
     float accelerationDot = Vector2::Dot(inputDirection, velocityDir);
-    float accelerationMultiplier = (accelerationDot >= 0.0f) ? CalculateAccelerationValue() : CalculateHandlingValue();
+    float accelerationMultiplier = (accelerationDot >= 0.0f) ? GetAccelerationValue() : GetHandlingValue();
     Vector2 accelerationComponent = velocityDir * accelerationDot * accelerationMultiplier;
-    Vector2 agilityComponent = perpindicularVelocityDir * Vector2::Dot(inputDirection, perpindicularVelocityDir) * CalculateHandlingValue();
+    Vector2 agilityComponent = perpindicularVelocityDir * Vector2::Dot(inputDirection, perpindicularVelocityDir) * GetHandlingValue();
 
     //Calculate velocity
     Vector2 totalAcceleration = accelerationComponent + agilityComponent;
     m_velocity += totalAcceleration;
-    m_velocity *= CalculateBrakingValue();
+    m_velocity *= GetBrakingValue();
     Vector2 clampedVelocity = m_velocity;
-    clampedVelocity.ClampMagnitude(CalculateTopSpeedValue());
+    clampedVelocity.ClampMagnitude(GetTopSpeedValue());
     Vector2 velocity = Lerp<Vector2>(0.8f, m_velocity, clampedVelocity);
 
     Vector2 attemptedPosition = m_transform.GetWorldPosition() + (velocity * deltaSeconds);
     SetPosition(attemptedPosition);
 
     //Rotate the ship towards it's direction of motion if it's not being rotated.
-    Vector2 shootDirection = input.GetVector2("ShootRight", "ShootUp");
-    bool isShooting = input.FindInputValue("Shoot")->IsDown();
+    Vector2 shootDirection = m_pilot->GetVector2(SHOOT_RIGHT_AXIS, SHOOT_UP_AXIS);
+    bool isShooting = m_pilot->IsDown(SHOOT_ACTION);
 
     if (shootDirection.CalculateMagnitudeSquared() < DEADZONE_BEFORE_ROTATION_SQUARED && !isShooting)
     {
@@ -233,12 +224,12 @@ float Ship::TakeDamage(float damage, float disruption /*= 1.0f*/)
     static SoundID brokeShieldSound = AudioSystem::instance->CreateOrGetSound("Data/SFX/Hit/SFX_Impact_Shield_08.wav");
     const float hitVolume = IsPlayer() ? TheGame::PLAYER_HIT_SOUND_VOLUME : TheGame::HIT_SOUND_VOLUME;
     float currentHp = m_currentHp;
-    float currentShieldCapacity = m_currentShieldHealth;
+    float currentShieldCapacity = m_loadout->m_currentShieldHealth;
     
     float damageTaken = Entity::TakeDamage(damage, disruption);
-    if (currentShieldCapacity != m_currentShieldHealth)
+    if (currentShieldCapacity != m_loadout->m_currentShieldHealth)
     {
-        if (m_currentShieldHealth != 0.0f && m_timeSinceLastHit < 0.25f)
+        if (m_loadout->m_currentShieldHealth != 0.0f && m_timeSinceLastHit < 0.25f)
         {
             TheGame::instance->m_currentGameMode->PlaySoundAt(hitShieldSound, GetPosition(), hitVolume, MathUtils::GetRandomFloat(0.9f, 1.1f));
         }
@@ -251,7 +242,7 @@ float Ship::TakeDamage(float damage, float disruption /*= 1.0f*/)
     {
         TheGame::instance->m_currentGameMode->PlaySoundAt(hitHullSound, GetPosition(), hitVolume, MathUtils::GetRandomFloat(0.9f, 1.1f));
 
-        float halfHealth = CalculateHpValue() * 0.5f;
+        float halfHealth = GetHpValue() * 0.5f;
         if (m_currentHp < halfHealth && !m_smokeDamage->m_isEnabled)
         {
             m_smokeDamage->Enable();
@@ -266,7 +257,7 @@ void Ship::Heal(float healValue /*= 99999999.0f*/)
 {
     Entity::Heal(healValue);
     
-    float halfHealth = CalculateHpValue() * 0.5f;
+    float halfHealth = GetHpValue() * 0.5f;
     if (m_currentHp > halfHealth && m_smokeDamage->m_isEnabled)
     {
         m_smokeDamage->Disable();
@@ -288,10 +279,10 @@ void Ship::Drain(float drainValue)
     float randomPercentage = MathUtils::GetRandomFloatFromZeroTo(0.2f);
     float randomDegrees = MathUtils::GetRandomFloat(-70.0f, 70.0f);
     Vector2 velocity = Vector2::DegreesToDirection(randomDegrees, Vector2::ZERO_DEGREES_UP) * 2.0f;
-    TextSplash::CreateTextSplash(Stringf("%i", static_cast<int>(drainValue)), m_transform, velocity, RGBA(1.0f, 1.0f - (0.8f + randomPercentage), 0.0f, 1.0f));
+    DamageNumbers::Spawn(m_handle, DamageNumbers::HULL_DAMAGE, static_cast<int>(drainValue), m_transform, velocity, RGBA(1.0f, 1.0f - (0.8f + randomPercentage), 0.0f, 1.0f));
     ParticleSystem::PlayOneShotParticleEffect("Drain", TheGame::BACKGROUND_PARTICLES_BLOOM_LAYER, Transform2D(), &m_transform);
 
-    float halfHealth = CalculateHpValue() * 0.5f;
+    float halfHealth = GetHpValue() * 0.5f;
     if (m_currentHp < halfHealth && !m_smokeDamage->m_isEnabled)
     {
         m_smokeDamage->Enable();
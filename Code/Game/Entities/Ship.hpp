@@ -16,7 +16,6 @@ public:
 
     //FUNCTIONS/////////////////////////////////////////////////////////////////////
     virtual void Update(float deltaSeconds);
-    virtual void ResolveCollision(Entity* otherEntity);
     virtual void LockMovement() { m_lockMovement = true; m_velocity = Vector2::ZERO; };
     virtual void UnlockMovement() { m_lockMovement = false; };
     virtual void ToggleMovement() { m_lockMovement = !m_lockMovement; };
@@ -51,6 +50,7 @@ public:
     float m_muzzleOffsetMagnitude = 0.25f;
     float m_secondsSinceLastFiredWeapon;
     float m_stealthFactor = 0.0f;
+    unsigned int m_statBlockIndex;
     bool m_lockMovement = false;
     RGBA m_factionColor = RGBA::WHITE;
     RGBA m_factionAltColor = RGBA::GBWHITE;
@@ -1,6 +1,7 @@
 #include "Game/Entities/TextSplash.hpp"
 #include "Engine/Renderer/2D/TextRenderable2D.hpp"
 #include "Game/TheGame.hpp"
+#include "Game/CommandBuffer.hpp"
 
 std::vector<TextSplash*, UntrackedAllocator<TextSplash*>> TextSplash::m_textSplashes;
 
@@ -33,8 +34,13 @@ void TextSplash::Cleanup()
 
 //-----------------------------------------------------------------------------------
 //Returns a splash in case you need to edit one's properties.
+//Returns null if called during a parallel update; the splash is created once the update's commands play back.
 TextSplash* TextSplash::CreateTextSplash(const std::string& text, const Transform2D& spawnTransform, const Vector2& velocity, RGBA color /*= RGBA::WHITE*/, int orderLayer /*= TheGame::TEXT_PARTICLE_LAYER*/)
 {
+    if (CommandBuffer::DeferIfRecording([=]() { CreateTextSplash(text, spawnTransform, velocity, color, orderLayer); }))
+    {
+        return nullptr;
+    }
     TextSplash* textSplash = new TextSplash(text, spawnTransform, velocity, color, orderLayer);
     textSplash->m_textRenderable->m_transform.SetScale(Vector2(1.0f));
     m_textSplashes.push_back(textSplash);
@@ -51,17 +57,18 @@ void TextSplash::Update(float deltaSeconds)
         text->m_textRenderable->m_transform.SetPosition(newPosition);
     }
 
-    for (auto iter = m_textSplashes.begin(); iter != m_textSplashes.end(); ++iter)
+    for (unsigned int i = 0; i < m_textSplashes.size();)
     {
-        TextSplash* textSplash = *iter;
+        TextSplash* textSplash = m_textSplashes[i];
         if (textSplash->m_age > textSplash->m_maxAge)
         {
             delete textSplash;
-            iter = m_textSplashes.erase(iter);
+            m_textSplashes[i] = m_textSplashes.back();
+            m_textSplashes.pop_back();
         }
-        if (iter == m_textSplashes.end())
+        else
         {
-            break;
+            ++i;
         }
     }
 }
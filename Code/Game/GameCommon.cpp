@@ -11,6 +11,8 @@ bool g_spawnGeometry            = true;
 bool g_nearlyInvulnerable       = false;
 bool g_spawnWithDebugLoadout    = true;
 bool g_disableMusic             = false;
+bool g_verifyStatCache          = false; //Check every cached stat read against a fresh calculation.
+float g_damageNumberCoalesceSeconds = 0.15f; //Hits on one target this close together share a damage number. 0 spawns one per hit.
 
 const size_t gEffectTimeUniform = std::hash<std::string>{}("gEffectTime");
 const size_t gWipeColorUniform = std::hash<std::string>{}("gWipeColor");
@@ -34,6 +34,8 @@ extern bool g_spawnGeometry;
 extern bool g_nearlyInvulnerable;
 extern bool g_spawnWithDebugLoadout;
 extern bool g_disableMusic;
+extern bool g_verifyStatCache;
+extern float g_damageNumberCoalesceSeconds;
 
 extern const size_t gEffectTimeUniform;
 extern const size_t gWipeColorUniform;
@@ -135,15 +135,8 @@ void AssemblyMode::FillMapWithAsteroids()
 }
 
 //-----------------------------------------------------------------------------------
-void AssemblyMode::Update(float deltaSeconds)
+void AssemblyMode::PreWorldStep(float deltaSeconds)
 {
-    GameMode::Update(deltaSeconds);
-    deltaSeconds = m_scaledDeltaSeconds;
-
-    if (!m_isPlaying)
-    {
-        return;
-    }
     m_timeSinceLastSpawn += deltaSeconds;
     if (g_spawnEnemies && g_spawnCrates && m_timeSinceLastSpawn > TIME_PER_SPAWN)
     {
@@ -151,36 +144,4 @@ void AssemblyMode::Update(float deltaSeconds)
         m_entities.push_back(new Grunt(GetRandomLocationInArena()));
         m_timeSinceLastSpawn = 0.0f;
     }
-    for (Entity* ent : m_entities)
-    {
-        ent->Update(deltaSeconds);
-        for (Entity* other : m_entities)
-        {
-            if ((ent != other) && (ent->IsCollidingWith(other)))
-            {
-                ent->ResolveCollision(other);
-            }
-        }
-    }
-    for (Entity* ent : m_newEntities)
-    {
-        m_entities.push_back(ent);
-    }
-    m_newEntities.clear();
-    for (auto iter = m_entities.begin(); iter != m_entities.end();)
-    {
-        Entity* gameObject = *iter;
-        if (gameObject->m_isDead && !gameObject->IsPlayer())
-        {
-            delete gameObject;
-            iter = m_entities.erase(iter);
-        }
-        if (iter == m_entities.end())
-        {
-            break;
-        }
-        ++iter;
-    }
-
-    UpdatePlayerCameras();
 }
\ No newline at end of file
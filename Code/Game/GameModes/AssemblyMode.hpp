@@ -17,7 +17,7 @@ public:
     virtual Encounter* GetRandomMinorEncounter(const Vector2& center, float radius) override;
 
     void FillMapWithAsteroids();
-    virtual void Update(float deltaSeconds);
+    virtual void PreWorldStep(float deltaSeconds);
 
     //MEMBER VARIABLES/////////////////////////////////////////////////////////////////////
 private:
@@ -0,0 +1,218 @@
+#include "Game/GameModes/CollisionGrid.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Time/Time.hpp"
+#include <algorithm>
+#include <cmath>
+
+//-----------------------------------------------------------------------------------
+void CollisionGrid::Reset(const AABB2& bounds)
+{
+    m_bounds = bounds;
+    m_proxies.clear();
+    m_proxyPositions.clear();
+    m_proxyRadii.clear();
+    m_candidatePairs.clear();
+    m_sumOfRadii = 0.0f;
+    m_isBuilt = false;
+}
+
+//-----------------------------------------------------------------------------------
+void CollisionGrid::AddProxy(unsigned int id, const Vector2& position, float radius, CollisionCategory category)
+{
+    Proxy proxy;
+    proxy.m_id = id;
+    proxy.m_category = category;
+    m_proxies.push_back(proxy);
+    m_proxyPositions.push_back(position);
+    m_proxyRadii.push_back(radius);
+    m_sumOfRadii += radius;
+}
+
+//-----------------------------------------------------------------------------------
+void CollisionGrid::Build()
+{
+    CalculateCellSize();
+
+    const unsigned int numProxies = m_proxies.size();
+    const unsigned int numCells = m_numCellsX * m_numCellsY;
+    m_cellStarts.assign(numCells + 1, 0);
+
+    //Count how many proxies land in each cell
+    for (unsigned int i = 0; i < numProxies; ++i)
+    {
+        Proxy& proxy = m_proxies[i];
+        const Vector2& position = m_proxyPositions[i];
+        float radius = m_proxyRadii[i];
+        proxy.m_minX = GetCellCoordinateX(position.x - radius);
+        proxy.m_maxX = GetCellCoordinateX(position.x + radius);
+        proxy.m_minY = GetCellCoordinateY(position.y - radius);
+        proxy.m_maxY = GetCellCoordinateY(position.y + radius);
+
+        for (int y = proxy.m_minY; y <= proxy.m_maxY; ++y)
+        {
+            for (int x = proxy.m_minX; x <= proxy.m_maxX; ++x)
+            {
+                ++m_cellStarts[(y * m_numCellsX) + x + 1];
+            }
+        }
+    }
+    for (unsigned int cell = 0; cell < numCells; ++cell)
+    {
+        m_cellStarts[cell + 1] += m_cellStarts[cell];
+    }
+
+    //Fill the cells, bumping each start forward as we go, then shift them back into place.
+    m_cellContents.resize(m_cellStarts[numCells]);
+    for (unsigned int i = 0; i < numProxies; ++i)
+    {
+        const Proxy& proxy = m_proxies[i];
+        for (int y = proxy.m_minY; y <= proxy.m_maxY; ++y)
+        {
+            for (int x = proxy.m_minX; x <= proxy.m_maxX; ++x)
+            {
+                m_cellContents[m_cellStarts[(y * m_numCellsX) + x]++] = i;
+            }
+        }
+    }
+    for (unsigned int cell = numCells; cell > 0; --cell)
+    {
+        m_cellStarts[cell] = m_cellStarts[cell - 1];
+    }
+    m_cellStarts[0] = 0;
+    m_isBuilt = true;
+}
+
+//-----------------------------------------------------------------------------------
+const std::vector<CollisionGrid::Pair>& CollisionGrid::FindCandidatePairs()
+{
+    m_candidatePairs.clear();
+    for (int cellY = 0; cellY < m_numCellsY; ++cellY)
+    {
+        for (int cellX = 0; cellX < m_numCellsX; ++cellX)
+        {
+            unsigned int cell = (cellY * m_numCellsX) + cellX;
+            unsigned int start = m_cellStarts[cell];
+            unsigned int end = m_cellStarts[cell + 1];
+            for (unsigned int i = start; i < end; ++i)
+            {
+                const Proxy& first = m_proxies[m_cellContents[i]];
+                for (unsigned int j = i + 1; j < end; ++j)
+                {
+                    const Proxy& second = m_proxies[m_cellContents[j]];
+                    if (!CollisionLayers::CanCategoriesInteract(first.m_category, second.m_category))
+                    {
+                        continue;
+                    }
+                    //Proxies that share several cells are only reported from the lowest shared one.
+                    int sharedX = std::max(first.m_minX, second.m_minX);
+                    int sharedY = std::max(first.m_minY, second.m_minY);
+                    if (sharedX == cellX && sharedY == cellY)
+                    {
+                        m_candidatePairs.emplace_back(first.m_id, second.m_id);
+                    }
+                }
+            }
+        }
+    }
+    return m_candidatePairs;
+}
+
+//-----------------------------------------------------------------------------------
+void CollisionGrid::CalculateCellSize()
+{
+    float width = m_bounds.maxs.x - m_bounds.mins.x;
+    float height = m_bounds.maxs.y - m_bounds.mins.y;
+    float averageRadius = m_proxies.empty() ? 0.0f : m_sumOfRadii / (float)m_proxies.size();
+
+    m_cellSize = std::max(MIN_CELL_SIZE, averageRadius * 2.0f);
+    m_cellSize = std::max(m_cellSize, std::max(width, height) / (float)MAX_CELLS_PER_AXIS);
+    m_numCellsX = std::max(1, (int)ceil(width / m_cellSize));
+    m_numCellsY = std::max(1, (int)ceil(height / m_cellSize));
+}
+
+//-----------------------------------------------------------------------------------
+int CollisionGrid::GetCellCoordinateX(float x) const
+{
+    int cellX = (int)floor((x - m_bounds.mins.x) / m_cellSize);
+    return std::min(std::max(cellX, 0), m_numCellsX - 1);
+}
+
+//-----------------------------------------------------------------------------------
+int CollisionGrid::GetCellCoordinateY(float y) const
+{
+    int cellY = (int)floor((y - m_bounds.mins.y) / m_cellSize);
+    return std::min(std::max(cellY, 0), m_numCellsY - 1);
+}
+
+//-----------------------------------------------------------------------------------
+void CollisionGrid::RunBenchmark()
+{
+    static const float WORLD_SIZE = 40.0f;
+    static const unsigned int NUM_TRIALS = 3;
+    static const unsigned int ENTITY_COUNTS[NUM_TRIALS] = { 500, 2000, 10000 };
+
+    AABB2 bounds(Vector2(-WORLD_SIZE, -WORLD_SIZE), Vector2(WORLD_SIZE, WORLD_SIZE));
+    std::vector<Vector2> positions;
+    std::vector<float> radii;
+    std::vector<CollisionCategory> categories;
+    CollisionGrid grid;
+
+    DebuggerPrintf("Broadphase benchmark, %.0fx%.0f arena\n", WORLD_SIZE * 2.0f, WORLD_SIZE * 2.0f);
+    for (unsigned int trial = 0; trial < NUM_TRIALS; ++trial)
+    {
+        unsigned int numEntities = ENTITY_COUNTS[trial];
+        positions.clear();
+        radii.clear();
+        categories.clear();
+        for (unsigned int i = 0; i < numEntities; ++i)
+        {
+            positions.push_back(Vector2(MathUtils::GetRandomFloat(-WORLD_SIZE, WORLD_SIZE), MathUtils::GetRandomFloat(-WORLD_SIZE, WORLD_SIZE)));
+            //Roughly 4 bullets for every ship, crate or asteroid.
+            bool isBullet = (i % 5 != 0);
+            radii.push_back(isBullet ? MathUtils::GetRandomFloat(0.1f, 0.25f) : MathUtils::GetRandomFloat(0.5f, 1.5f));
+            categories.push_back(isBullet ? PROJECTILE_CATEGORY : PROP_CATEGORY);
+        }
+
+        double bruteForceStart = GetCurrentTimeSeconds();
+        unsigned int bruteForceContacts = 0;
+        for (unsigned int i = 0; i < numEntities; ++i)
+        {
+            for (unsigned int j = i + 1; j < numEntities; ++j)
+            {
+                if (!CollisionLayers::CanCategoriesInteract(categories[i], categories[j]))
+                {
+                    continue;
+                }
+                float sumOfRadii = radii[i] + radii[j];
+                if (MathUtils::CalcDistSquaredBetweenPoints(positions[i], positions[j]) < sumOfRadii * sumOfRadii)
+                {
+                    ++bruteForceContacts;
+                }
+            }
+        }
+        double bruteForceSeconds = GetCurrentTimeSeconds() - bruteForceStart;
+
+        double gridStart = GetCurrentTimeSeconds();
+        grid.Reset(bounds);
+        for (unsigned int i = 0; i < numEntities; ++i)
+        {
+            grid.AddProxy(i, positions[i], radii[i], categories[i]);
+        }
+        grid.Build();
+        unsigned int gridContacts = 0;
+        for (const Pair& pair : grid.FindCandidatePairs())
+        {
+            float sumOfRadii = radii[pair.m_first] + radii[pair.m_second];
+            if (MathUtils::CalcDistSquaredBetweenPoints(positions[pair.m_first], positions[pair.m_second]) < sumOfRadii * sumOfRadii)
+            {
+                ++gridContacts;
+            }
+        }
+        double gridSeconds = GetCurrentTimeSeconds() - gridStart;
+
+        ASSERT_OR_DIE(gridContacts == bruteForceContacts, "Broadphase missed or duplicated a contact");
+        DebuggerPrintf("%5u entities: brute force %u pairs, %.3fms | grid (cell %.2f) %u candidate pairs, %u contacts, %.3fms\n",
+            numEntities, (numEntities * (numEntities - 1)) / 2, bruteForceSeconds * 1000.0, grid.GetCellSize(), grid.GetNumCandidatePairs(), gridContacts, gridSeconds * 1000.0);
+    }
+}
@@ -0,0 +1,105 @@
+#pragma once
+#include "Engine/Math/Vector2.hpp"
+#include "Engine/Renderer/AABB2.hpp"
+#include "Game/Entities/CollisionCategory.hpp"
+#include <vector>
+#include <algorithm>
+
+//Uniform grid broadphase. Proxies are circles, inserted into every cell their bounds overlap.
+//-----------------------------------------------------------------------------------
+class CollisionGrid
+{
+public:
+    //STRUCTS/////////////////////////////////////////////////////////////////////
+    struct Pair
+    {
+        Pair(unsigned int first, unsigned int second) : m_first(first), m_second(second) {};
+        unsigned int m_first;
+        unsigned int m_second;
+    };
+
+    //CONSTRUCTORS/////////////////////////////////////////////////////////////////////
+    CollisionGrid() {};
+    ~CollisionGrid() {};
+
+    //FUNCTIONS/////////////////////////////////////////////////////////////////////
+    void Reset(const AABB2& bounds);
+    void AddProxy(unsigned int id, const Vector2& position, float radius, CollisionCategory category);
+    void Build();
+    const std::vector<Pair>& FindCandidatePairs();
+    template <typename Callback> void ForEachProxyInBox(const Vector2& mins, const Vector2& maxs, CollisionMask categories, Callback callback) const;
+    inline unsigned int GetNumProxies() const { return m_proxies.size(); };
+    inline unsigned int GetNumCandidatePairs() const { return m_candidatePairs.size(); };
+    inline float GetCellSize() const { return m_cellSize; };
+    inline bool IsBuilt() const { return m_isBuilt; };
+
+    //STATIC FUNCTIONS/////////////////////////////////////////////////////////////////////
+    static void RunBenchmark();
+
+private:
+    struct Proxy
+    {
+        unsigned int m_id;
+        CollisionCategory m_category;
+        int m_minX;
+        int m_minY;
+        int m_maxX;
+        int m_maxY;
+    };
+
+    void CalculateCellSize();
+    int GetCellCoordinateX(float x) const;
+    int GetCellCoordinateY(float y) const;
+
+    //CONSTANTS/////////////////////////////////////////////////////////////////////
+    static constexpr float MIN_CELL_SIZE = 0.5f;
+    static constexpr int MAX_CELLS_PER_AXIS = 128;
+
+    //MEMBER VARIABLES/////////////////////////////////////////////////////////////////////
+    AABB2 m_bounds;
+    std::vector<Proxy> m_proxies;
+    std::vector<Vector2> m_proxyPositions;
+    std::vector<float> m_proxyRadii;
+    std::vector<unsigned int> m_cellStarts;
+    std::vector<unsigned int> m_cellContents;
+    std::vector<Pair> m_candidatePairs;
+    float m_cellSize = 1.0f;
+    float m_sumOfRadii = 0.0f;
+    int m_numCellsX = 1;
+    int m_numCellsY = 1;
+    bool m_isBuilt = false;
+};
+
+//Visits the id of every proxy whose bounds overlap the box, once each.
+//-----------------------------------------------------------------------------------
+template <typename Callback>
+void CollisionGrid::ForEachProxyInBox(const Vector2& mins, const Vector2& maxs, CollisionMask categories, Callback callback) const
+{
+    if (!m_isBuilt)
+    {
+        return;
+    }
+    int minX = GetCellCoordinateX(mins.x);
+    int maxX = GetCellCoordinateX(maxs.x);
+    int minY = GetCellCoordinateY(mins.y);
+    int maxY = GetCellCoordinateY(maxs.y);
+    for (int cellY = minY; cellY <= maxY; ++cellY)
+    {
+        for (int cellX = minX; cellX <= maxX; ++cellX)
+        {
+            unsigned int cell = (cellY * m_numCellsX) + cellX;
+            for (unsigned int i = m_cellStarts[cell]; i < m_cellStarts[cell + 1]; ++i)
+            {
+                const Proxy& proxy = m_proxies[m_cellContents[i]];
+                if ((categories & CollisionLayers::GetCategoryBit(proxy.m_category)) == 0)
+                {
+                    continue;
+                }
+                if (std::max(proxy.m_minX, minX) == cellX && std::max(proxy.m_minY, minY) == cellY)
+                {
+                    callback(proxy.m_id);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,101 @@
+#include "Game/GameModes/EnemyDirector.hpp"
+#include "Game/GameModes/GameMode.hpp"
+#include "Game/Entities/PlayerShip.hpp"
+#include "Game/Pilots/BasicEnemyPilot.hpp"
+#include "Engine/Math/MathUtils.hpp"
+
+//One bucket per fixed step, so every enemy is revisited once per targeting period.
+const unsigned int EnemyDirector::NUM_RETARGET_BUCKETS = static_cast<unsigned int>(BasicEnemyPilot::TIME_IN_BETWEEN_TARGETING_SECONDS / GameMode::FIXED_STEP_SECONDS + 0.5f);
+
+//-----------------------------------------------------------------------------------
+EnemyDirector::EnemyDirector()
+    : m_buckets(NUM_RETARGET_BUCKETS)
+{
+
+}
+
+//-----------------------------------------------------------------------------------
+void EnemyDirector::AddEnemy(Ship* enemy)
+{
+    m_buckets[m_nextBucketToFill].push_back(enemy->m_handle);
+    m_nextBucketToFill = (m_nextBucketToFill + 1) % NUM_RETARGET_BUCKETS;
+}
+
+//-----------------------------------------------------------------------------------
+void EnemyDirector::Step(const std::vector<PlayerShip*>& players, const AABB2& arenaBounds)
+{
+    SnapshotPlayers(players);
+    m_flowField.Update(arenaBounds, m_playerHandles, m_playerPositions);
+    RetargetBucket(m_buckets[m_currentBucket]);
+    m_currentBucket = (m_currentBucket + 1) % NUM_RETARGET_BUCKETS;
+}
+
+//-----------------------------------------------------------------------------------
+void EnemyDirector::Clear()
+{
+    for (std::vector<EntityHandle>& bucket : m_buckets)
+    {
+        bucket.clear();
+    }
+    m_currentBucket = 0;
+    m_nextBucketToFill = 0;
+    m_playerHandles.clear();
+    m_playerPositions.clear();
+    m_detectionRadiiSquared.clear();
+    m_flowField.Clear();
+}
+
+//-----------------------------------------------------------------------------------
+void EnemyDirector::SnapshotPlayers(const std::vector<PlayerShip*>& players)
+{
+    m_playerHandles.clear();
+    m_playerPositions.clear();
+    m_detectionRadiiSquared.clear();
+    for (PlayerShip* player : players)
+    {
+        if (player->IsDead())
+        {
+            continue;
+        }
+        m_playerHandles.push_back(player->m_handle);
+        m_playerPositions.push_back(player->GetPosition());
+        m_detectionRadiiSquared.push_back(BasicEnemyPilot::DETECTION_RADIUS_SQUARED * (Ship::MAX_STEALTH_FACTOR - player->m_stealthFactor));
+    }
+}
+
+//-----------------------------------------------------------------------------------
+void EnemyDirector::RetargetBucket(std::vector<EntityHandle>& bucket)
+{
+    for (unsigned int i = 0; i < bucket.size();)
+    {
+        Ship* enemy = EntityRegistry::instance->ResolveAs<Ship>(bucket[i]);
+        if (!enemy)
+        {
+            bucket[i] = bucket.back();
+            bucket.pop_back();
+            continue;
+        }
+        BasicEnemyPilot* pilot = static_cast<BasicEnemyPilot*>(enemy->m_pilot);
+        pilot->m_currentTarget = FindVisiblePlayer(enemy->GetPosition());
+        ++i;
+    }
+}
+
+//Nearest player whose own detection radius (shrunk by their stealth) reaches this position.
+//-----------------------------------------------------------------------------------
+EntityHandle EnemyDirector::FindVisiblePlayer(const Vector2& position) const
+{
+    EntityHandle bestPlayer;
+    float bestDistSquared = 9999999.0f;
+    const unsigned int numPlayers = m_playerPositions.size();
+    for (unsigned int i = 0; i < numPlayers; ++i)
+    {
+        float distSquared = MathUtils::CalcDistSquaredBetweenPoints(m_playerPositions[i], position);
+        if (distSquared < m_detectionRadiiSquared[i] && distSquared < bestDistSquared)
+        {
+            bestDistSquared = distSquared;
+            bestPlayer = m_playerHandles[i];
+        }
+    }
+    return bestPlayer;
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include "Engine/Math/Vector2.hpp"
+#include "Game/Entities/EntityRegistry.hpp"
+#include "Game/GameModes/FlowField.hpp"
+#include <vector>
+
+class Ship;
+class PlayerShip;
+
+//Owns targeting for every AI pilot in a game mode. Once per step it snapshots the living players' positions and
+//stealth-scaled detection radii, then retargets one bucket of enemies against that snapshot. Enemies are dealt into
+//buckets round-robin, so a squadron spawned together is spread across the whole retarget period instead of spiking one frame.
+//It also keeps the flow field that steers enemies toward each player around static props.
+//-----------------------------------------------------------------------------------
+class EnemyDirector
+{
+public:
+    //CONSTRUCTORS/////////////////////////////////////////////////////////////////////
+    EnemyDirector();
+    ~EnemyDirector() {};
+
+    //FUNCTIONS/////////////////////////////////////////////////////////////////////
+    void AddEnemy(Ship* enemy);
+    void Step(const std::vector<PlayerShip*>& players, const AABB2& arenaBounds);
+    void Clear();
+    EntityHandle FindVisiblePlayer(const Vector2& position) const;
+    inline unsigned int GetNumPlayers() const { return m_playerPositions.size(); };
+    inline const Vector2& GetPlayerPosition(unsigned int index) const { return m_playerPositions[index]; };
+    inline FlowField& GetFlowField() { return m_flowField; };
+
+    //CONSTANTS/////////////////////////////////////////////////////////////////////
+    static const unsigned int NUM_RETARGET_BUCKETS;
+
+private:
+    void SnapshotPlayers(const std::vector<PlayerShip*>& players);
+    void RetargetBucket(std::vector<EntityHandle>& bucket);
+
+    //MEMBER VARIABLES/////////////////////////////////////////////////////////////////////
+    std::vector<std::vector<EntityHandle>> m_buckets;
+    unsigned int m_currentBucket = 0;
+    unsigned int m_nextBucketToFill = 0;
+    std::vector<EntityHandle> m_playerHandles;
+    std::vector<Vector2> m_playerPositions;
+    std::vector<float> m_detectionRadiiSquared;
+    FlowField m_flowField;
+};
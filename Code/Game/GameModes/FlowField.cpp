@@ -0,0 +1,216 @@
+#include "Game/GameModes/FlowField.hpp"
+#include "Game/Entities/Entity.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    const int NEIGHBOR_OFFSETS_X[8] = { 1, -1, 0, 0, 1, 1, -1, -1 };
+    const int NEIGHBOR_OFFSETS_Y[8] = { 0, 0, 1, -1, 1, -1, 1, -1 };
+    const float INVERSE_SQRT_TWO = 0.70710678f;
+}
+
+//Copies the circles out so the field never holds onto entities that can be reaped before it next rebuilds.
+//Zones that ships fly through (nebulae, healing zones) aren't obstacles.
+//-----------------------------------------------------------------------------------
+void FlowField::SetObstacles(const std::vector<Entity*>& staticEntities)
+{
+    m_obstaclePositions.clear();
+    m_obstacleRadii.clear();
+    for (Entity* ent : staticEntities)
+    {
+        if (ent->m_kind == NEBULA_KIND || ent->m_kind == HEALING_ZONE_KIND)
+        {
+            continue;
+        }
+        m_obstaclePositions.push_back(ent->GetPosition());
+        m_obstacleRadii.push_back(ent->m_collisionRadius);
+    }
+    m_areObstaclesDirty = true;
+}
+
+//-----------------------------------------------------------------------------------
+void FlowField::Update(const AABB2& bounds, const std::vector<EntityHandle>& targets, const std::vector<Vector2>& targetPositions)
+{
+    if (m_numCellsX == 0 || bounds.mins.x != m_bounds.mins.x || bounds.mins.y != m_bounds.mins.y || bounds.maxs.x != m_bounds.maxs.x || bounds.maxs.y != m_bounds.maxs.y)
+    {
+        Resize(bounds);
+    }
+    bool didObstaclesChange = false;
+    if (m_areObstaclesDirty)
+    {
+        std::vector<unsigned char> wasBlocked = m_isBlocked;
+        RasterizeObstacles();
+        didObstaclesChange = (wasBlocked != m_isBlocked);
+    }
+
+    //Fields line up with the targets list, which only reshuffles when a player dies or respawns.
+    m_fields.resize(targets.size());
+    for (unsigned int i = 0; i < targets.size(); ++i)
+    {
+        TargetField& field = m_fields[i];
+        int targetCell = GetCellIndex(targetPositions[i]);
+        if (didObstaclesChange || field.m_target != targets[i] || field.m_targetCell != targetCell)
+        {
+            field.m_target = targets[i];
+            field.m_targetCell = targetCell;
+            BuildField(field);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------------
+void FlowField::Clear()
+{
+    m_obstaclePositions.clear();
+    m_obstacleRadii.clear();
+    m_fields.clear();
+    m_areObstaclesDirty = true;
+}
+
+//Picks the neighbor closest to the target. Returns false when there's nothing better than flying straight at it:
+//no field for that target, already in the target's cell, or walled off from it entirely.
+//-----------------------------------------------------------------------------------
+bool FlowField::GetFlowDirection(EntityHandle target, const Vector2& position, Vector2& outDirection) const
+{
+    const TargetField* field = nullptr;
+    for (const TargetField& candidate : m_fields)
+    {
+        if (candidate.m_target == target)
+        {
+            field = &candidate;
+            break;
+        }
+    }
+    if (!field)
+    {
+        return false;
+    }
+
+    int cell = GetCellIndex(position);
+    int cellX = cell % m_numCellsX;
+    int cellY = cell / m_numCellsX;
+    unsigned short bestDistance = field->m_distances[cell];
+    if (bestDistance == 0)
+    {
+        return false;
+    }
+    int bestNeighbor = -1;
+    for (int i = 0; i < 8; ++i)
+    {
+        int neighborX = cellX + NEIGHBOR_OFFSETS_X[i];
+        int neighborY = cellY + NEIGHBOR_OFFSETS_Y[i];
+        if (neighborX < 0 || neighborX >= m_numCellsX || neighborY < 0 || neighborY >= m_numCellsY)
+        {
+            continue;
+        }
+        //Don't cut a corner past a blocked cell.
+        if (i >= 4 && (m_isBlocked[(cellY * m_numCellsX) + neighborX] || m_isBlocked[(neighborY * m_numCellsX) + cellX]))
+        {
+            continue;
+        }
+        unsigned short distance = field->m_distances[(neighborY * m_numCellsX) + neighborX];
+        if (distance < bestDistance)
+        {
+            bestDistance = distance;
+            bestNeighbor = i;
+        }
+    }
+    if (bestNeighbor < 0)
+    {
+        return false;
+    }
+    float scale = bestNeighbor >= 4 ? INVERSE_SQRT_TWO : 1.0f;
+    outDirection = Vector2((float)NEIGHBOR_OFFSETS_X[bestNeighbor] * scale, (float)NEIGHBOR_OFFSETS_Y[bestNeighbor] * scale);
+    return true;
+}
+
+//-----------------------------------------------------------------------------------
+void FlowField::Resize(const AABB2& bounds)
+{
+    m_bounds = bounds;
+    float width = bounds.maxs.x - bounds.mins.x;
+    float height = bounds.maxs.y - bounds.mins.y;
+    m_cellSize = std::max(MIN_CELL_SIZE, std::max(width, height) / (float)MAX_CELLS_PER_AXIS);
+    m_numCellsX = std::max(1, (int)ceil(width / m_cellSize));
+    m_numCellsY = std::max(1, (int)ceil(height / m_cellSize));
+    m_isBlocked.clear();
+    m_fields.clear();
+    m_areObstaclesDirty = true;
+}
+
+//A cell is blocked when its center is within an obstacle's radius plus enough clearance for a ship to pass.
+//-----------------------------------------------------------------------------------
+void FlowField::RasterizeObstacles()
+{
+    m_isBlocked.assign(m_numCellsX * m_numCellsY, 0);
+    for (unsigned int i = 0; i < m_obstaclePositions.size(); ++i)
+    {
+        const Vector2& center = m_obstaclePositions[i];
+        float radius = m_obstacleRadii[i] + OBSTACLE_CLEARANCE;
+        float radiusSquared = radius * radius;
+        int minX = std::max(0, (int)floor((center.x - radius - m_bounds.mins.x) / m_cellSize));
+        int maxX = std::min(m_numCellsX - 1, (int)floor((center.x + radius - m_bounds.mins.x) / m_cellSize));
+        int minY = std::max(0, (int)floor((center.y - radius - m_bounds.mins.y) / m_cellSize));
+        int maxY = std::min(m_numCellsY - 1, (int)floor((center.y + radius - m_bounds.mins.y) / m_cellSize));
+        for (int y = minY; y <= maxY; ++y)
+        {
+            float cellCenterY = m_bounds.mins.y + ((float)y + 0.5f) * m_cellSize;
+            for (int x = minX; x <= maxX; ++x)
+            {
+                float cellCenterX = m_bounds.mins.x + ((float)x + 0.5f) * m_cellSize;
+                float deltaX = cellCenterX - center.x;
+                float deltaY = cellCenterY - center.y;
+                if ((deltaX * deltaX) + (deltaY * deltaY) < radiusSquared)
+                {
+                    m_isBlocked[(y * m_numCellsX) + x] = 1;
+                }
+            }
+        }
+    }
+    m_areObstaclesDirty = false;
+}
+
+//Breadth-first out from the target's cell through open cells. Blocked cells keep UNREACHABLE,
+//so a ship pushed inside one still steers out toward whichever open neighbor is closest.
+//-----------------------------------------------------------------------------------
+void FlowField::BuildField(TargetField& field)
+{
+    field.m_distances.assign(m_numCellsX * m_numCellsY, UNREACHABLE);
+    m_frontier.clear();
+    field.m_distances[field.m_targetCell] = 0;
+    m_frontier.push_back(field.m_targetCell);
+    for (unsigned int head = 0; head < m_frontier.size(); ++head)
+    {
+        unsigned int cell = m_frontier[head];
+        int cellX = cell % m_numCellsX;
+        int cellY = cell / m_numCellsX;
+        unsigned short nextDistance = field.m_distances[cell] + 1;
+        for (int i = 0; i < 4; ++i)
+        {
+            int neighborX = cellX + NEIGHBOR_OFFSETS_X[i];
+            int neighborY = cellY + NEIGHBOR_OFFSETS_Y[i];
+            if (neighborX < 0 || neighborX >= m_numCellsX || neighborY < 0 || neighborY >= m_numCellsY)
+            {
+                continue;
+            }
+            unsigned int neighbor = (neighborY * m_numCellsX) + neighborX;
+            if (m_isBlocked[neighbor] || field.m_distances[neighbor] != UNREACHABLE)
+            {
+                continue;
+            }
+            field.m_distances[neighbor] = nextDistance;
+            m_frontier.push_back(neighbor);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------------
+int FlowField::GetCellIndex(const Vector2& position) const
+{
+    int cellX = (int)floor((position.x - m_bounds.mins.x) / m_cellSize);
+    int cellY = (int)floor((position.y - m_bounds.mins.y) / m_cellSize);
+    cellX = std::min(std::max(cellX, 0), m_numCellsX - 1);
+    cellY = std::min(std::max(cellY, 0), m_numCellsY - 1);
+    return (cellY * m_numCellsX) + cellX;
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include "Engine/Math/Vector2.hpp"
+#include "Engine/Renderer/AABB2.hpp"
+#include "Game/Entities/EntityRegistry.hpp"
+#include <vector>
+
+class Entity;
+
+//Coarse breadth-first distance field over the arena toward each player, routed around static props.
+//Obstacles are only re-rasterized when the static index is rebuilt, and a player's field is only redone when the
+//obstacles change or that player moves to another cell, so most steps do no work at all.
+//-----------------------------------------------------------------------------------
+class FlowField
+{
+public:
+    //CONSTRUCTORS/////////////////////////////////////////////////////////////////////
+    FlowField() {};
+    ~FlowField() {};
+
+    //FUNCTIONS/////////////////////////////////////////////////////////////////////
+    void SetObstacles(const std::vector<Entity*>& staticEntities);
+    void Update(const AABB2& bounds, const std::vector<EntityHandle>& targets, const std::vector<Vector2>& targetPositions);
+    void Clear();
+    bool GetFlowDirection(EntityHandle target, const Vector2& position, Vector2& outDirection) const;
+    inline float GetCellSize() const { return m_cellSize; };
+
+    //CONSTANTS/////////////////////////////////////////////////////////////////////
+    static constexpr float MIN_CELL_SIZE = 1.5f;
+    static constexpr int MAX_CELLS_PER_AXIS = 96;
+    static constexpr float OBSTACLE_CLEARANCE = 0.75f;
+    static constexpr unsigned short UNREACHABLE = 0xFFFF;
+
+private:
+    struct TargetField
+    {
+        EntityHandle m_target;
+        int m_targetCell = -1;
+        std::vector<unsigned short> m_distances;
+    };
+
+    void Resize(const AABB2& bounds);
+    void RasterizeObstacles();
+    void BuildField(TargetField& field);
+    int GetCellIndex(const Vector2& position) const;
+
+    //MEMBER VARIABLES/////////////////////////////////////////////////////////////////////
+    AABB2 m_bounds;
+    std::vector<Vector2> m_obstaclePositions;
+    std::vector<float> m_obstacleRadii;
+    std::vector<unsigned char> m_isBlocked;
+    std::vector<TargetField> m_fields;
+    std::vector<unsigned int> m_frontier;
+    float m_cellSize = 1.0f;
+    int m_numCellsX = 0;
+    int m_numCellsY = 0;
+    bool m_areObstaclesDirty = true;
+};
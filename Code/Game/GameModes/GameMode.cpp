@@ -22,6 +22,10 @@
 #include "Game/Encounters/BossteroidEncounter.hpp"
 #include "Engine/Input/XInputController.hpp"
 #include "Engine/Renderer/OpenGLExtensions.hpp"
+#include "Engine/Core/ProfilingUtils.h"
+#include "Game/WorkerPool.hpp"
+#include "Game/StatBlockRegistry.hpp"
+#include <algorithm>
 #include "../Entities/Props/Wormhole.hpp"
 
 #undef PlaySound
@@ -53,18 +57,10 @@ GameMode::~GameMode()
 {
     StopPlaying();
 
-    for (Encounter* encounter : m_encounters)
-    {
-        delete encounter;
-    }
-    for (auto iterator : m_playerStats)
-    {
-        delete iterator.second;
-    }
+    //Encounters and stats hold nothing but plain data and non-owning pointers, so the arena drops them all at once.
+    m_encounters.clear();
     m_playerStats.clear();
-
-
-
+    m_arena.Reset();
     delete m_arenaBackground;
     m_arenaBackground = nullptr;
     delete m_starfield;
@@ -124,6 +120,8 @@ void GameMode::CleanUp()
 //-----------------------------------------------------------------------------------
 void GameMode::DeleteAllEntities()
 {
+    m_transformCache.Clear();
+    m_enemyDirector.Clear();
     for (Entity* ent : m_entities)
     {
         if (!ent->IsPlayer())
@@ -132,11 +130,15 @@ void GameMode::DeleteAllEntities()
         }
     }
     m_entities.clear();
+    m_staticEntities.clear();
+    m_isStaticIndexDirty = true;
+    InvalidateSpatialIndex();
 }
 
 //-----------------------------------------------------------------------------------
 void GameMode::Update(float deltaSeconds)
 {
+    RestoreSimState();
     m_scaledDeltaSeconds = deltaSeconds;
     if (m_isPlaying)
     {
@@ -229,6 +231,459 @@ void GameMode::Update(float deltaSeconds)
     {
         StopPlaying();
     }
+    if (m_isPlaying)
+    {
+        AdvanceWorld(m_scaledDeltaSeconds);
+    }
+}
+
+//Runs as many fixed steps as the elapsed time covers, then draws entities partway into the next one.
+//Button presses are latched per rendered frame and only visible to the first step, so a frame with no steps doesn't drop them
+//and a frame with several doesn't repeat them. Axes and held buttons are still read fresh every step.
+//-----------------------------------------------------------------------------------
+void GameMode::AdvanceWorld(float deltaSeconds)
+{
+    for (PlayerShip* player : m_players)
+    {
+        player->m_pilot->LatchPresses();
+    }
+    m_stepAccumulatorSeconds += deltaSeconds;
+    unsigned int numSteps = 0;
+    while (m_stepAccumulatorSeconds >= FIXED_STEP_SECONDS && numSteps < MAX_STEPS_PER_FRAME)
+    {
+        StepWorld(FIXED_STEP_SECONDS);
+        m_stepAccumulatorSeconds -= FIXED_STEP_SECONDS;
+        if (numSteps == 0)
+        {
+            for (PlayerShip* player : m_players)
+            {
+                player->m_pilot->ClearLatchedPresses();
+            }
+        }
+        ++numSteps;
+        if (!m_isPlaying)
+        {
+            //PostWorldStep ended the round, so the rest of this frame's steps would play past the end of it.
+            break;
+        }
+    }
+    if (!m_isPlaying)
+    {
+        return;
+    }
+    if (m_stepAccumulatorSeconds >= FIXED_STEP_SECONDS)
+    {
+        //Too far behind to catch up. Drop the backlog so a hitch slows the game down for a frame instead of snowballing.
+        m_stepAccumulatorSeconds = fmod(m_stepAccumulatorSeconds, FIXED_STEP_SECONDS);
+    }
+
+    ShowInterpolatedState(m_stepAccumulatorSeconds / FIXED_STEP_SECONDS);
+    UpdatePlayerCameras();
+}
+
+//-----------------------------------------------------------------------------------
+void GameMode::StepWorld(float deltaSeconds)
+{
+    PreWorldStep(deltaSeconds);
+
+    ProfilingSystem::instance->PushSample("TransformCache");
+    m_transformCache.Rebuild(m_entities);
+    ProfilingSystem::instance->PopSample("TransformCache");
+
+    ProfilingSystem::instance->PushSample("EnemyDirector");
+    m_enemyDirector.Step(m_players, GetArenaBounds());
+    ProfilingSystem::instance->PopSample("EnemyDirector");
+
+    ProfilingSystem::instance->PushSample("StatBlocks");
+    StatBlockRegistry::instance->RefreshDirtyBlocks();
+    ProfilingSystem::instance->PopSample("StatBlocks");
+
+    ProfilingSystem::instance->PushSample("EntityUpdate");
+    UpdateEntities(deltaSeconds);
+    ProfilingSystem::instance->PopSample("EntityUpdate");
+
+    ProfilingSystem::instance->PushSample("Kinematics");
+    m_kinematics.Step(m_entities, deltaSeconds, GetArenaBounds());
+    ProfilingSystem::instance->PopSample("Kinematics");
+
+    ResolveEntityCollisions();
+    MergeNewEntities();
+    ReapDeadEntities();
+
+    PostWorldStep(deltaSeconds);
+}
+
+//Entities that only touch themselves update across the worker pool first, recording any spawns, sounds
+//or text into one command buffer per chunk. The buffers play back in chunk order so the results match a serial run.
+//Everything else (ships, pilots, anything that reaches into other entities) then updates on this thread.
+//-----------------------------------------------------------------------------------
+void GameMode::UpdateEntities(float deltaSeconds)
+{
+    m_parallelUpdateEntities.clear();
+    m_serialUpdateEntities.clear();
+    for (Entity* ent : m_entities)
+    {
+        ent->RecordPreviousSimState();
+        if (ent->CanUpdateInParallel())
+        {
+            m_parallelUpdateEntities.push_back(ent);
+        }
+        else
+        {
+            m_serialUpdateEntities.push_back(ent);
+        }
+    }
+
+    const unsigned int numParallelEntities = m_parallelUpdateEntities.size();
+    const unsigned int numChunks = (numParallelEntities + ENTITIES_PER_UPDATE_CHUNK - 1) / ENTITIES_PER_UPDATE_CHUNK;
+    if (m_updateCommandBuffers.size() < numChunks)
+    {
+        m_updateCommandBuffers.resize(numChunks);
+    }
+    WorkerPool::instance->ParallelFor(numChunks, [&](unsigned int chunkIndex)
+    {
+        unsigned int start = chunkIndex * ENTITIES_PER_UPDATE_CHUNK;
+        unsigned int end = Min<unsigned int>(start + ENTITIES_PER_UPDATE_CHUNK, numParallelEntities);
+        CommandBuffer::BeginRecording(&m_updateCommandBuffers[chunkIndex]);
+        for (unsigned int i = start; i < end; ++i)
+        {
+            m_parallelUpdateEntities[i]->Update(deltaSeconds);
+        }
+        CommandBuffer::EndRecording();
+    });
+    for (unsigned int chunkIndex = 0; chunkIndex < numChunks; ++chunkIndex)
+    {
+        m_updateCommandBuffers[chunkIndex].Execute();
+    }
+
+    for (Entity* ent : m_serialUpdateEntities)
+    {
+        ent->Update(deltaSeconds);
+    }
+}
+
+//-----------------------------------------------------------------------------------
+void GameMode::ResolveEntityCollisions()
+{
+    ProfilingSystem::instance->PushSample("Broadphase");
+    RebuildSpatialIndex();
+    const std::vector<CollisionGrid::Pair>& candidatePairs = m_dynamicGrid.FindCandidatePairs();
+    ProfilingSystem::instance->PopSample("Broadphase");
+
+    ProfilingSystem::instance->PushSample("Narrowphase");
+    if (m_hasUnresolvedStaticOverlaps)
+    {
+        ResolveStaticOverlaps();
+    }
+    DetectContacts(candidatePairs);
+    ProfilingSystem::instance->PopSample("Narrowphase");
+
+    ProfilingSystem::instance->PushSample("ContactResolution");
+    ResolveContacts();
+    ResolveSweptContacts();
+    ProfilingSystem::instance->PopSample("ContactResolution");
+}
+
+//Static entities can only start overlapping each other when the static set changes, so they're only separated then.
+//-----------------------------------------------------------------------------------
+void GameMode::ResolveStaticOverlaps()
+{
+    m_contacts.clear();
+    for (const CollisionGrid::Pair& pair : m_staticGrid.FindCandidatePairs())
+    {
+        DetectPotentialContact(m_staticEntities[pair.m_first], m_staticEntities[pair.m_second], m_contacts);
+    }
+    if (ResolveContacts() > 0)
+    {
+        RebuildStaticIndex();
+    }
+    m_hasUnresolvedStaticOverlaps = false;
+}
+
+//Tests every candidate pair, plus each moving entity against the static grid, across the worker pool.
+//Nothing is modified here; each chunk writes the contacts it finds to its own list.
+//-----------------------------------------------------------------------------------
+void GameMode::DetectContacts(const std::vector<CollisionGrid::Pair>& candidatePairs)
+{
+    const unsigned int numPairs = candidatePairs.size();
+    const unsigned int numEntities = m_entities.size();
+    const unsigned int numPairChunks = (numPairs + CONTACT_TESTS_PER_CHUNK - 1) / CONTACT_TESTS_PER_CHUNK;
+    const unsigned int numEntityChunks = (numEntities + CONTACT_TESTS_PER_CHUNK - 1) / CONTACT_TESTS_PER_CHUNK;
+    const unsigned int numChunks = numPairChunks + numEntityChunks;
+    if (m_chunkContacts.size() < numChunks)
+    {
+        m_chunkContacts.resize(numChunks);
+    }
+
+    WorkerPool::instance->ParallelFor(numChunks, [&](unsigned int chunkIndex)
+    {
+        std::vector<Contact>& contacts = m_chunkContacts[chunkIndex];
+        contacts.clear();
+        if (chunkIndex < numPairChunks)
+        {
+            unsigned int start = chunkIndex * CONTACT_TESTS_PER_CHUNK;
+            unsigned int end = Min<unsigned int>(start + CONTACT_TESTS_PER_CHUNK, numPairs);
+            for (unsigned int i = start; i < end; ++i)
+            {
+                DetectPotentialContact(m_entities[candidatePairs[i].m_first], m_entities[candidatePairs[i].m_second], contacts);
+            }
+            return;
+        }
+
+        //Moving entities look themselves up in the static grid, static pairs are never tested here.
+        unsigned int start = (chunkIndex - numPairChunks) * CONTACT_TESTS_PER_CHUNK;
+        unsigned int end = Min<unsigned int>(start + CONTACT_TESTS_PER_CHUNK, numEntities);
+        for (unsigned int i = start; i < end; ++i)
+        {
+            Entity* ent = m_entities[i];
+            if (ent->m_isStatic)
+            {
+                continue;
+            }
+            Vector2 center;
+            float radius;
+            ent->GetSweptBounds(center, radius);
+            Vector2 extents(radius, radius);
+            m_staticGrid.ForEachProxyInBox(center - extents, center + extents, CollisionLayers::GetInteractingCategories(ent->m_collisionCategory), [&](unsigned int staticIndex)
+            {
+                DetectPotentialContact(ent, m_staticEntities[staticIndex], contacts);
+            });
+        }
+    });
+
+    m_contacts.clear();
+    for (unsigned int chunkIndex = 0; chunkIndex < numChunks; ++chunkIndex)
+    {
+        m_contacts.insert(m_contacts.end(), m_chunkContacts[chunkIndex].begin(), m_chunkContacts[chunkIndex].end());
+    }
+}
+
+//Applies the detected contacts in entity id order, so the outcome doesn't depend on how detection was split up.
+//Earlier contacts can push entities apart, so overlap contacts are re-tested before they're applied.
+//-----------------------------------------------------------------------------------
+unsigned int GameMode::ResolveContacts()
+{
+    std::sort(m_contacts.begin(), m_contacts.end(), &GameMode::IsResolvedBefore);
+    unsigned int numResolvedContacts = 0;
+    for (const Contact& contact : m_contacts)
+    {
+        if (contact.m_isSwept)
+        {
+            m_sweptContacts.emplace_back((Projectile*)contact.m_first, contact.m_second, contact.m_timeOfImpact);
+            continue;
+        }
+        if (contact.m_first->IsCollidingWith(contact.m_second))
+        {
+            Entity::ResolveContact(contact.m_first, contact.m_second);
+            ++numResolvedContacts;
+        }
+    }
+    m_contacts.clear();
+    return numResolvedContacts;
+}
+
+//-----------------------------------------------------------------------------------
+void GameMode::DetectPotentialContact(Entity* ent, Entity* other, std::vector<Contact>& outContacts)
+{
+    if (!CollisionLayers::CanMasksInteract(ent->m_collisionCategory, ent->m_collisionMask, other->m_collisionCategory, other->m_collisionMask))
+    {
+        return;
+    }
+    if (other->IsProjectile() && !ent->IsProjectile())
+    {
+        std::swap(ent, other);
+    }
+    if (ent->IsProjectile())
+    {
+        float timeOfImpact = 0.0f;
+        if (((Projectile*)ent)->CalculateTimeOfImpact(other, timeOfImpact))
+        {
+            outContacts.emplace_back(ent, other, true, timeOfImpact);
+        }
+        return;
+    }
+    if (ent->IsCollidingWith(other))
+    {
+        if (other->m_entityId < ent->m_entityId)
+        {
+            std::swap(ent, other);
+        }
+        outContacts.emplace_back(ent, other, false, 0.0f);
+    }
+}
+
+//-----------------------------------------------------------------------------------
+bool GameMode::IsResolvedBefore(const Contact& first, const Contact& second)
+{
+    unsigned int firstLow = Min<unsigned int>(first.m_first->m_entityId, first.m_second->m_entityId);
+    unsigned int secondLow = Min<unsigned int>(second.m_first->m_entityId, second.m_second->m_entityId);
+    if (firstLow != secondLow)
+    {
+        return firstLow < secondLow;
+    }
+    unsigned int firstHigh = Max<unsigned int>(first.m_first->m_entityId, first.m_second->m_entityId);
+    unsigned int secondHigh = Max<unsigned int>(second.m_first->m_entityId, second.m_second->m_entityId);
+    return firstHigh < secondHigh;
+}
+
+//Bullet hits are resolved earliest first, so a shot stops at the first thing in its path rather than everything it swept over.
+//A shot that's used up is moved back to the point of impact, one that survives (explosions, vortex pulls) carries on with the rest
+//of its sweep from wherever the hit left it. If the hit moved it (a wormhole), the rest of its old path no longer applies.
+//-----------------------------------------------------------------------------------
+void GameMode::ResolveSweptContacts()
+{
+    //Stable, so hits at the same instant keep the entity id order they were queued in.
+    std::stable_sort(m_sweptContacts.begin(), m_sweptContacts.end(), [](const SweptContact& first, const SweptContact& second)
+    {
+        return first.m_timeOfImpact < second.m_timeOfImpact;
+    });
+    m_divertedProjectiles.clear();
+    for (const SweptContact& contact : m_sweptContacts)
+    {
+        Projectile* projectile = contact.m_projectile;
+        if (projectile->m_isDead || std::find(m_divertedProjectiles.begin(), m_divertedProjectiles.end(), projectile) != m_divertedProjectiles.end())
+        {
+            continue;
+        }
+        Vector2 endPosition = projectile->GetPosition();
+        Vector2 impactPosition = projectile->GetSweepPosition(contact.m_timeOfImpact);
+        projectile->SetPosition(impactPosition);
+        Entity::ResolveContact(projectile, contact.m_other);
+        if (projectile->m_isDead)
+        {
+            continue;
+        }
+        Vector2 resolvedPosition = projectile->GetPosition();
+        projectile->SetPosition(resolvedPosition + (endPosition - impactPosition));
+        if (resolvedPosition.x != impactPosition.x || resolvedPosition.y != impactPosition.y)
+        {
+            m_divertedProjectiles.push_back(projectile);
+        }
+    }
+    m_sweptContacts.clear();
+}
+
+//-----------------------------------------------------------------------------------
+void GameMode::RebuildSpatialIndex()
+{
+    unsigned int numStaticEntities = 0;
+    m_dynamicGrid.Reset(GetArenaBounds());
+    for (unsigned int i = 0; i < m_entities.size(); ++i)
+    {
+        Entity* ent = m_entities[i];
+        if (ent->m_isStatic)
+        {
+            ++numStaticEntities;
+            continue;
+        }
+        Vector2 center;
+        float radius;
+        ent->GetSweptBounds(center, radius);
+        m_dynamicGrid.AddProxy(i, center, radius, ent->m_collisionCategory);
+    }
+    m_dynamicGrid.Build();
+
+    if (m_isStaticIndexDirty || numStaticEntities != m_staticEntities.size() || HaveStaticEntitiesChanged())
+    {
+        RebuildStaticIndex();
+    }
+    m_isSpatialIndexValid = true;
+}
+
+//Static proxies are padded by the drift tolerance, so the grid stays conservative until a rebuild is due.
+//-----------------------------------------------------------------------------------
+void GameMode::RebuildStaticIndex()
+{
+    ProfilingSystem::instance->PushSample("StaticRebuild");
+    m_staticEntities.clear();
+    m_staticPositions.clear();
+    m_staticRadii.clear();
+    m_staticGrid.Reset(GetArenaBounds());
+    for (Entity* ent : m_entities)
+    {
+        if (ent->m_isStatic)
+        {
+            m_staticGrid.AddProxy(m_staticEntities.size(), ent->GetPosition(), ent->m_collisionRadius + STATIC_DRIFT_TOLERANCE, ent->m_collisionCategory);
+            m_staticEntities.push_back(ent);
+            m_staticPositions.push_back(ent->GetPosition());
+            m_staticRadii.push_back(ent->m_collisionRadius);
+        }
+    }
+    m_staticGrid.Build();
+    m_enemyDirector.GetFlowField().SetObstacles(m_staticEntities);
+    m_isStaticIndexDirty = false;
+    m_hasUnresolvedStaticOverlaps = true;
+    ProfilingSystem::instance->PopSample("StaticRebuild");
+}
+
+//-----------------------------------------------------------------------------------
+bool GameMode::HaveStaticEntitiesChanged()
+{
+    const float DRIFT_TOLERANCE_SQUARED = STATIC_DRIFT_TOLERANCE * STATIC_DRIFT_TOLERANCE;
+    for (unsigned int i = 0; i < m_staticEntities.size(); ++i)
+    {
+        Entity* ent = m_staticEntities[i];
+        if (!ent->m_isStatic || ent->m_collisionRadius != m_staticRadii[i])
+        {
+            return true;
+        }
+        if (MathUtils::CalcDistSquaredBetweenPoints(ent->GetPosition(), m_staticPositions[i]) > DRIFT_TOLERANCE_SQUARED)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+//-----------------------------------------------------------------------------------
+void GameMode::MergeNewEntities()
+{
+    m_entities.insert(m_entities.end(), m_newEntities.begin(), m_newEntities.end());
+    m_newEntities.clear();
+    InvalidateSpatialIndex();
+}
+
+//-----------------------------------------------------------------------------------
+void GameMode::ReapDeadEntities()
+{
+    for (unsigned int i = 0; i < m_entities.size();)
+    {
+        Entity* ent = m_entities[i];
+        if (ent->m_isDead && !ent->IsPlayer())
+        {
+            m_isStaticIndexDirty = m_isStaticIndexDirty || ent->m_isStatic;
+            delete ent;
+            m_entities[i] = m_entities.back();
+            m_entities.pop_back();
+            continue;
+        }
+        ++i;
+    }
+    InvalidateSpatialIndex();
+}
+
+//-----------------------------------------------------------------------------------
+void GameMode::ShowInterpolatedState(float alpha)
+{
+    for (Entity* ent : m_entities)
+    {
+        ent->ShowInterpolatedState(alpha);
+    }
+    m_isShowingInterpolatedState = true;
+}
+
+//-----------------------------------------------------------------------------------
+void GameMode::RestoreSimState()
+{
+    if (!m_isShowingInterpolatedState)
+    {
+        return;
+    }
+    for (Entity* ent : m_entities)
+    {
+        ent->RestoreSimState();
+    }
+    m_isShowingInterpolatedState = false;
 }
 
 //-----------------------------------------------------------------------------------
@@ -238,7 +693,7 @@ void GameMode::UpdatePlayerCameras()
     {
         PlayerShip* player = m_players[i];
         Vector2 targetCameraPosition = player->GetPosition();
-        Vector2 playerRightStick = player->m_pilot->m_inputMap.GetVector2("ShootRight", "ShootUp");
+        Vector2 playerRightStick = player->m_pilot->GetVector2(SHOOT_RIGHT_AXIS, SHOOT_UP_AXIS);
 
         if (InputSystem::instance->WasKeyJustPressed('R'))
         {
@@ -316,8 +771,10 @@ void GameMode::RemoveEntitiesInCircle(const Vector2& center, float radius)
         
         if (!entity->IsPlayer() && isInRadius)
         {
+            m_isStaticIndexDirty = m_isStaticIndexDirty || entity->m_isStatic;
             delete entity;
             iter = m_entities.erase(iter);
+            InvalidateSpatialIndex();
             continue;
         }
         if (iter == m_entities.end())
@@ -343,6 +800,10 @@ AABB2 GameMode::GetArenaBounds()
 //-----------------------------------------------------------------------------------
 void GameMode::SpawnEntityInGameWorld(Entity* entity)
 {
+    if (CommandBuffer::DeferIfRecording([=]() { SpawnEntityInGameWorld(entity); }))
+    {
+        return;
+    }
     entity->m_currentGameMode = this; 
     m_newEntities.push_back(entity);
 }
@@ -350,7 +811,12 @@ void GameMode::SpawnEntityInGameWorld(Entity* entity)
 //-----------------------------------------------------------------------------------
 void GameMode::SpawnBullet(Projectile* bullet)
 {
+    if (CommandBuffer::DeferIfRecording([=]() { SpawnBullet(bullet); }))
+    {
+        return;
+    }
     bullet->m_currentGameMode = this;
+    bullet->RecordSweepStart();
     m_newEntities.push_back(bullet);
 }
 
@@ -358,6 +824,10 @@ void GameMode::SpawnBullet(Projectile* bullet)
 void GameMode::SpawnPickup(Item* item, const Vector2& spawnPosition)
 {
     ASSERT_OR_DIE(item, "Item was null when attempting to spawn pickup");
+    if (CommandBuffer::DeferIfRecording([=]() { SpawnPickup(item, spawnPosition); }))
+    {
+        return;
+    }
     Pickup* pickup = new Pickup(item, spawnPosition);
     pickup->m_currentGameMode = this;
     m_newEntities.push_back(pickup);
@@ -393,6 +863,10 @@ float GameMode::CalculateAttenuation(const Vector2& soundPosition)
 //-----------------------------------------------------------------------------------
 void GameMode::PlaySoundAt(const SoundID sound, const Vector2& soundPosition, float maxVolume /*= 1.0f*/, float pitchMultiplier /*= 1.0f*/)
 {
+    if (CommandBuffer::DeferIfRecording([=]() { PlaySoundAt(sound, soundPosition, maxVolume, pitchMultiplier); }))
+    {
+        return;
+    }
     float attenuationVolume = CalculateAttenuation(soundPosition);
     float clampedVolume = Min<float>(attenuationVolume, maxVolume);
     AudioSystem::instance->PlaySound(sound, clampedVolume);
@@ -405,6 +879,27 @@ GameMode* GameMode::GetCurrent()
     return TheGame::instance->m_currentGameMode;
 }
 
+//-----------------------------------------------------------------------------------
+LinearArena* GameMode::GetCurrentArena()
+{
+    GameMode* current = TheGame::instance ? TheGame::instance->m_currentGameMode : nullptr;
+    return current ? &current->m_arena : nullptr;
+}
+
+//-----------------------------------------------------------------------------------
+void* DefaultPlayerStats::operator new(size_t size)
+{
+    LinearArena* arena = GameMode::GetCurrentArena();
+    ASSERT_OR_DIE(arena, "Player stats can only be created while a game mode is current");
+    return arena->Allocate(size);
+}
+
+//-----------------------------------------------------------------------------------
+void DefaultPlayerStats::operator delete(void* storage)
+{
+    UNUSED(storage);
+}
+
 //-----------------------------------------------------------------------------------
 void GameMode::StopPlaying()
 {
@@ -710,18 +1205,60 @@ void GameMode::SpawnEncounters()
     SetVortexPositions();
 }
 
-std::vector<Entity*> GameMode::GetEntitiesInRadiusSquared(const Vector2& centerPosition, float radiusSquared)
+//-----------------------------------------------------------------------------------
+unsigned int GameMode::FindEntitiesInCircle(const Vector2& center, float radius, std::vector<Entity*>& outEntities, const EntityFilter& filter)
+{
+    outEntities.clear();
+    ForEachEntityInCircle(center, radius, filter, [&](Entity* entity)
+    {
+        outEntities.push_back(entity);
+    });
+    return outEntities.size();
+}
+
+//-----------------------------------------------------------------------------------
+unsigned int GameMode::FindEntitiesInAABB(const AABB2& bounds, std::vector<Entity*>& outEntities, const EntityFilter& filter)
 {
-    std::vector<Entity*> foundEntities;
-    for (Entity* entity : m_entities)
+    outEntities.clear();
+    ForEachEntityInAABB(bounds, filter, [&](Entity* entity)
     {
-        Vector2 entityPos = entity->GetPosition();
-        float distBetweenEntityAndPointSquared = MathUtils::CalcDistSquaredBetweenPoints(centerPosition, entityPos);
+        outEntities.push_back(entity);
+    });
+    return outEntities.size();
+}
 
-        if (distBetweenEntityAndPointSquared < radiusSquared)
-        {
-            foundEntities.push_back(entity);
-        }
+//-----------------------------------------------------------------------------------
+unsigned int GameMode::FindNearestEntities(const Vector2& center, float maxRadius, unsigned int maxCount, std::vector<Entity*>& outEntities, const EntityFilter& filter)
+{
+    FindEntitiesInCircle(center, maxRadius, outEntities, filter);
+    unsigned int numToKeep = std::min<unsigned int>(maxCount, outEntities.size());
+    std::partial_sort(outEntities.begin(), outEntities.begin() + numToKeep, outEntities.end(), [&](Entity* first, Entity* second)
+    {
+        return MathUtils::CalcDistSquaredBetweenPoints(center, first->GetPosition()) < MathUtils::CalcDistSquaredBetweenPoints(center, second->GetPosition());
+    });
+    outEntities.resize(numToKeep);
+    return numToKeep;
+}
+
+//-----------------------------------------------------------------------------------
+bool GameMode::PassesFilter(Entity* entity, const EntityFilter& filter)
+{
+    if (entity->IsDead() && !filter.m_includeDead)
+    {
+        return false;
     }
-    return std::move(foundEntities);
+    return !filter.m_notOwnedBy || entity->m_owner != filter.m_notOwnedBy->m_handle;
+}
+
+//-----------------------------------------------------------------------------------
+bool GameMode::IsInCircle(Entity* entity, const Vector2& center, float radiusSquared)
+{
+    return MathUtils::CalcDistSquaredBetweenPoints(center, entity->GetPosition()) < radiusSquared;
+}
+
+//-----------------------------------------------------------------------------------
+bool GameMode::IsInAABB(Entity* entity, const AABB2& bounds)
+{
+    Vector2 position = entity->GetPosition();
+    return position.x >= bounds.mins.x && position.x <= bounds.maxs.x && position.y >= bounds.mins.y && position.y <= bounds.maxs.y;
 }
@@ -1,6 +1,12 @@
 #pragma once
 #include "Engine\Renderer\2D\Sprite.hpp"
 #include "Engine\Audio\Audio.hpp"
+#include "Game/GameModes/CollisionGrid.hpp"
+#include "Game/GameModes/KinematicsStore.hpp"
+#include "Game/GameModes/WorldTransformCache.hpp"
+#include "Game/GameModes/EnemyDirector.hpp"
+#include "Game/CommandBuffer.hpp"
+#include "Game/LinearArena.hpp"
 #include <vector>
 
 class Entity;
@@ -18,12 +24,26 @@ struct DefaultPlayerStats
 {
     DefaultPlayerStats(PlayerShip* player) : m_player(player) {};
     virtual ~DefaultPlayerStats() {};
+    //Stats live in the current mode's arena and are never deleted one by one; the mode resets the arena instead.
+    static void* operator new(size_t size);
+    static void operator delete(void* storage);
 
     PlayerShip* m_player = nullptr;
     int m_numKills = 0;
     int m_numDeaths = 0;
 };
 
+//Which entities a spatial query reports. Categories are matched against each entity's collision category.
+//-----------------------------------------------------------------------------------
+struct EntityFilter
+{
+    EntityFilter(CollisionMask categories = ALL_COLLISION_CATEGORIES, const Entity* notOwnedBy = nullptr) : m_categories(categories), m_notOwnedBy(notOwnedBy) {};
+
+    CollisionMask m_categories;
+    const Entity* m_notOwnedBy;
+    bool m_includeDead = false;
+};
+
 //-----------------------------------------------------------------------------------
 class GameMode
 {
@@ -37,6 +57,20 @@ public:
     virtual void CleanUp();
     void DeleteAllEntities();
     virtual void Update(float deltaSeconds);
+    void AdvanceWorld(float deltaSeconds);
+    void StepWorld(float deltaSeconds);
+    void UpdateEntities(float deltaSeconds);
+    virtual void PreWorldStep(float) {};
+    virtual void PostWorldStep(float) {};
+    void ResolveEntityCollisions();
+    void ResolveStaticOverlaps();
+    void DetectContacts(const std::vector<CollisionGrid::Pair>& candidatePairs);
+    unsigned int ResolveContacts();
+    void ResolveSweptContacts();
+    void MergeNewEntities();
+    void ReapDeadEntities();
+    void ShowInterpolatedState(float alpha);
+    void RestoreSimState();
     virtual void UpdatePlayerCameras();
     virtual Vector2 GetRandomLocationInArena(float radius = 0.0f);
     virtual Vector2 GetPlayerSpawnPoint(int playerNumber);
@@ -68,7 +102,18 @@ public:
     void ClearVortexPositions();
     inline int GetNextVortexID() { return s_currentVortexId++; };
     virtual void SpawnEncounters();
-    virtual std::vector<Entity*> GetEntitiesInRadiusSquared(const Vector2& centerPosition, float radiusSquared);
+
+    //SPATIAL QUERIES/////////////////////////////////////////////////////////////////////
+    unsigned int FindEntitiesInCircle(const Vector2& center, float radius, std::vector<Entity*>& outEntities, const EntityFilter& filter = EntityFilter());
+    unsigned int FindEntitiesInAABB(const AABB2& bounds, std::vector<Entity*>& outEntities, const EntityFilter& filter = EntityFilter());
+    unsigned int FindNearestEntities(const Vector2& center, float maxRadius, unsigned int maxCount, std::vector<Entity*>& outEntities, const EntityFilter& filter = EntityFilter());
+    template <typename Callback> void ForEachEntityInCircle(const Vector2& center, float radius, const EntityFilter& filter, Callback callback);
+    template <typename Callback> void ForEachEntityInAABB(const AABB2& bounds, const EntityFilter& filter, Callback callback);
+    void RebuildSpatialIndex();
+    void RebuildStaticIndex();
+    bool HaveStaticEntitiesChanged();
+    inline void EnsureSpatialIndex() { if (!m_isSpatialIndexValid) { RebuildSpatialIndex(); } };
+    inline void InvalidateSpatialIndex() { m_isSpatialIndexValid = false; };
 
     //PLAYER DATA/////////////////////////////////////////////////////////////////////
     virtual void InitializePlayerData();
@@ -79,12 +124,19 @@ public:
 
     //STATIC FUNCTIONS/////////////////////////////////////////////////////////////////////
     static GameMode* GetCurrent();
+    static LinearArena* GetCurrentArena();
     
     //MEMBER VARIABLES/////////////////////////////////////////////////////////////////////
 public:
     static const double AFTER_GAME_SLOWDOWN_SECONDS;
     static const double ANIMATION_LENGTH_SECONDS;
     static const int MAX_NUM_VORTEXES = 16;
+    static constexpr float FIXED_STEP_SECONDS = 1.0f / 60.0f;
+    static constexpr unsigned int MAX_STEPS_PER_FRAME = 4;
+    static constexpr unsigned int ENTITIES_PER_UPDATE_CHUNK = 64;
+    static constexpr unsigned int CONTACT_TESTS_PER_CHUNK = 128;
+    static constexpr float SPATIAL_QUERY_SLOP = 1.0f;
+    static constexpr float STATIC_DRIFT_TOLERANCE = 0.05f;
     static int s_currentVortexId;
 
     float MIN_MINOR_RADIUS = 3.0f;
@@ -101,10 +153,18 @@ public:
     std::vector<Entity*> m_entities;
     std::vector<Entity*> m_newEntities;
     std::vector<Encounter*> m_encounters;
+    std::vector<Entity*> m_staticEntities;
+    CollisionGrid m_dynamicGrid;
+    CollisionGrid m_staticGrid;
+    KinematicsStore m_kinematics;
+    WorldTransformCache m_transformCache;
+    EnemyDirector m_enemyDirector;
+    LinearArena m_arena; //Encounters and player stats created while this mode is current. Reset in bulk by the destructor.
     const char* m_modeTitleText;
     const char* m_modeDescriptionText;
     float m_gameLengthSeconds = 2000.0f;
     float m_scaledDeltaSeconds = 0.0f;
+    float m_stepAccumulatorSeconds = 0.0f;
     SoundID m_backgroundMusic = 0;
     bool m_respawnAllowed = true;
     bool m_isPlaying = false;
@@ -114,6 +174,31 @@ public:
     RGBA m_readyTextColor = RGBA::RED;
 
 private:
+    //A touching pair found by the detect stage. Swept contacts always have the projectile first.
+    struct Contact
+    {
+        Contact(Entity* first, Entity* second, bool isSwept, float timeOfImpact) : m_first(first), m_second(second), m_isSwept(isSwept), m_timeOfImpact(timeOfImpact) {};
+        Entity* m_first;
+        Entity* m_second;
+        bool m_isSwept;
+        float m_timeOfImpact;
+    };
+
+    struct SweptContact
+    {
+        SweptContact(Projectile* projectile, Entity* other, float timeOfImpact) : m_projectile(projectile), m_other(other), m_timeOfImpact(timeOfImpact) {};
+        Projectile* m_projectile;
+        Entity* m_other;
+        float m_timeOfImpact;
+    };
+
+    static void DetectPotentialContact(Entity* ent, Entity* other, std::vector<Contact>& outContacts);
+    static bool IsResolvedBefore(const Contact& first, const Contact& second);
+
+    bool PassesFilter(Entity* entity, const EntityFilter& filter);
+    bool IsInCircle(Entity* entity, const Vector2& center, float radiusSquared);
+    bool IsInAABB(Entity* entity, const AABB2& bounds);
+
     std::vector<Vector2> m_playerSpawnPoints;
     Sprite* m_arenaBackground = nullptr;
     Sprite* m_starfield = nullptr;
@@ -127,4 +212,54 @@ private:
     Material* m_readyAnimFBOEffect = nullptr;
     TextRenderable2D* m_modeTitleRenderable = nullptr;
     TextRenderable2D* m_getReadyRenderable = nullptr;
-};
\ No newline at end of file
+    std::vector<Vector2> m_staticPositions;
+    std::vector<float> m_staticRadii;
+    std::vector<Contact> m_contacts;
+    std::vector<std::vector<Contact>> m_chunkContacts;
+    std::vector<SweptContact> m_sweptContacts;
+    std::vector<Projectile*> m_divertedProjectiles;
+    std::vector<Entity*> m_parallelUpdateEntities;
+    std::vector<Entity*> m_serialUpdateEntities;
+    std::vector<CommandBuffer> m_updateCommandBuffers;
+    bool m_isSpatialIndexValid = false;
+    bool m_isShowingInterpolatedState = false;
+    bool m_isStaticIndexDirty = true;
+    bool m_hasUnresolvedStaticOverlaps = false;
+};
+
+//Queries run against the index from the last rebuild. Entities that moved less than SPATIAL_QUERY_SLOP since then
+//are still found, and positions are re-tested exactly. Entities spawned since the last merge aren't reported.
+//-----------------------------------------------------------------------------------
+template <typename Callback>
+void GameMode::ForEachEntityInCircle(const Vector2& center, float radius, const EntityFilter& filter, Callback callback)
+{
+    EnsureSpatialIndex();
+    const float radiusSquared = radius * radius;
+    const Vector2 extents(radius + SPATIAL_QUERY_SLOP, radius + SPATIAL_QUERY_SLOP);
+    auto visit = [&](Entity* entity)
+    {
+        if (PassesFilter(entity, filter) && IsInCircle(entity, center, radiusSquared))
+        {
+            callback(entity);
+        }
+    };
+    m_dynamicGrid.ForEachProxyInBox(center - extents, center + extents, filter.m_categories, [&](unsigned int entityIndex) { visit(m_entities[entityIndex]); });
+    m_staticGrid.ForEachProxyInBox(center - extents, center + extents, filter.m_categories, [&](unsigned int staticIndex) { visit(m_staticEntities[staticIndex]); });
+}
+
+//-----------------------------------------------------------------------------------
+template <typename Callback>
+void GameMode::ForEachEntityInAABB(const AABB2& bounds, const EntityFilter& filter, Callback callback)
+{
+    EnsureSpatialIndex();
+    const Vector2 slop(SPATIAL_QUERY_SLOP, SPATIAL_QUERY_SLOP);
+    auto visit = [&](Entity* entity)
+    {
+        if (PassesFilter(entity, filter) && IsInAABB(entity, bounds))
+        {
+            callback(entity);
+        }
+    };
+    m_dynamicGrid.ForEachProxyInBox(bounds.mins - slop, bounds.maxs + slop, filter.m_categories, [&](unsigned int entityIndex) { visit(m_entities[entityIndex]); });
+    m_staticGrid.ForEachProxyInBox(bounds.mins - slop, bounds.maxs + slop, filter.m_categories, [&](unsigned int staticIndex) { visit(m_staticEntities[staticIndex]); });
+}
\ No newline at end of file
@@ -63,10 +63,18 @@ void InstancedGameMode::ShowBackground()
 //-----------------------------------------------------------------------------------
 void InstancedGameMode::SpawnBullet(Projectile* bullet)
 {
-    bullet->m_currentGameMode = bullet->m_owner->m_currentGameMode;
+    if (CommandBuffer::DeferIfRecording([=]() { SpawnBullet(bullet); }))
+    {
+        return;
+    }
+    Entity* owner = bullet->GetOwner();
+    if (owner)
+    {
+        bullet->m_currentGameMode = owner->m_currentGameMode;
+    }
     for (GameMode* instance : m_gameModeInstances)
     {
-        if (instance == bullet->m_owner->m_currentGameMode)
+        if (instance == bullet->m_currentGameMode)
         {
             instance->m_newEntities.push_back(bullet);
         }
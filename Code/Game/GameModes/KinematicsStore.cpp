@@ -0,0 +1,93 @@
+#include "Game/GameModes/KinematicsStore.hpp"
+#include "Game/Entities/Entity.hpp"
+#include <algorithm>
+#include <cfloat>
+
+//-----------------------------------------------------------------------------------
+void KinematicsStore::Step(const std::vector<Entity*>& entities, float deltaSeconds, const AABB2& bounds)
+{
+    Gather(entities);
+    Integrate(deltaSeconds, bounds);
+    Scatter();
+}
+
+//-----------------------------------------------------------------------------------
+void KinematicsStore::Gather(const std::vector<Entity*>& entities)
+{
+    m_movers.clear();
+    m_positionsX.clear();
+    m_positionsY.clear();
+    m_velocitiesX.clear();
+    m_velocitiesY.clear();
+    m_frictions.clear();
+    m_moveScales.clear();
+    m_boundsInsets.clear();
+    m_rotations.clear();
+    m_angularVelocities.clear();
+
+    for (Entity* ent : entities)
+    {
+        if (!ent->m_hasSimpleKinematics)
+        {
+            continue;
+        }
+        Vector2 position = ent->m_transform.GetWorldPosition();
+        m_movers.push_back(ent);
+        m_positionsX.push_back(position.x);
+        m_positionsY.push_back(position.y);
+        m_velocitiesX.push_back(ent->m_velocity.x);
+        m_velocitiesY.push_back(ent->m_velocity.y);
+        m_frictions.push_back(ent->m_frictionValue);
+        m_moveScales.push_back(ent->m_appliesFrictionBeforeMoving ? ent->m_frictionValue : 1.0f);
+        //A negative inset of FLT_MAX turns the clamp into a no-op for entities allowed to leave the arena.
+        m_boundsInsets.push_back(ent->m_staysWithinBounds ? ent->m_collisionRadius : -FLT_MAX);
+        m_rotations.push_back(ent->m_transform.GetWorldRotationDegrees());
+        m_angularVelocities.push_back(ent->m_angularVelocity);
+    }
+}
+
+//No branches and no entity pointers in here, so this loop stays friendly to the auto-vectorizer.
+//-----------------------------------------------------------------------------------
+void KinematicsStore::Integrate(float deltaSeconds, const AABB2& bounds)
+{
+    const unsigned int numMovers = m_movers.size();
+    float* positionsX = m_positionsX.data();
+    float* positionsY = m_positionsY.data();
+    float* velocitiesX = m_velocitiesX.data();
+    float* velocitiesY = m_velocitiesY.data();
+    float* rotations = m_rotations.data();
+    const float* frictions = m_frictions.data();
+    const float* moveScales = m_moveScales.data();
+    const float* boundsInsets = m_boundsInsets.data();
+    const float* angularVelocities = m_angularVelocities.data();
+
+    for (unsigned int i = 0; i < numMovers; ++i)
+    {
+        float moveSeconds = deltaSeconds * moveScales[i];
+        float x = positionsX[i] + (velocitiesX[i] * moveSeconds);
+        float y = positionsY[i] + (velocitiesY[i] * moveSeconds);
+        float inset = boundsInsets[i];
+        positionsX[i] = std::min(std::max(x, bounds.mins.x + inset), bounds.maxs.x - inset);
+        positionsY[i] = std::min(std::max(y, bounds.mins.y + inset), bounds.maxs.y - inset);
+        velocitiesX[i] *= frictions[i];
+        velocitiesY[i] *= frictions[i];
+        rotations[i] += angularVelocities[i] * deltaSeconds;
+    }
+}
+
+//-----------------------------------------------------------------------------------
+void KinematicsStore::Scatter()
+{
+    const unsigned int numMovers = m_movers.size();
+    for (unsigned int i = 0; i < numMovers; ++i)
+    {
+        Entity* ent = m_movers[i];
+        ent->m_velocity = Vector2(m_velocitiesX[i], m_velocitiesY[i]);
+        ent->m_transform.SetPosition(Vector2(m_positionsX[i], m_positionsY[i]));
+        ent->MarkTransformDirty();
+        if (m_angularVelocities[i] != 0.0f)
+        {
+            ent->m_transform.SetRotationDegrees(m_rotations[i]);
+        }
+    }
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include "Engine/Renderer/AABB2.hpp"
+#include <vector>
+
+class Entity;
+
+//Structure-of-arrays mirror of the entities that only drift, spin and slow down.
+//Their motion is gathered out of the entities, integrated in one tight loop, then written back.
+//-----------------------------------------------------------------------------------
+class KinematicsStore
+{
+public:
+    //CONSTRUCTORS/////////////////////////////////////////////////////////////////////
+    KinematicsStore() {};
+    ~KinematicsStore() {};
+
+    //FUNCTIONS/////////////////////////////////////////////////////////////////////
+    void Step(const std::vector<Entity*>& entities, float deltaSeconds, const AABB2& bounds);
+    void Gather(const std::vector<Entity*>& entities);
+    void Integrate(float deltaSeconds, const AABB2& bounds);
+    void Scatter();
+    inline unsigned int GetNumMovers() const { return m_movers.size(); };
+
+private:
+    //MEMBER VARIABLES/////////////////////////////////////////////////////////////////////
+    std::vector<Entity*> m_movers;
+    std::vector<float> m_positionsX;
+    std::vector<float> m_positionsY;
+    std::vector<float> m_velocitiesX;
+    std::vector<float> m_velocitiesY;
+    std::vector<float> m_frictions;
+    std::vector<float> m_moveScales; //Movers that apply friction before moving travel on the slowed velocity.
+    std::vector<float> m_boundsInsets;
+    std::vector<float> m_rotations;
+    std::vector<float> m_angularVelocities;
+};
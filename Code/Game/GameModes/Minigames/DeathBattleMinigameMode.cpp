@@ -114,54 +114,14 @@ void DeathBattleMinigameMode::RecordPlayerDeath(PlayerShip* ship)
 }
 
 //-----------------------------------------------------------------------------------
-void DeathBattleMinigameMode::Update(float deltaSeconds)
+void DeathBattleMinigameMode::PostWorldStep(float)
 {
-    BaseMinigameMode::Update(deltaSeconds);
-    deltaSeconds = m_scaledDeltaSeconds;
-
-    if (!m_isPlaying)
-    {
-        return;
-    }
-    for (Entity* ent : m_entities)
-    {
-        ent->Update(deltaSeconds);
-        for (Entity* other : m_entities)
-        {
-            if ((ent != other) && (ent->IsCollidingWith(other)))
-            {
-                ent->ResolveCollision(other);
-            }
-        }
-    }
-    for (Entity* ent : m_newEntities)
-    {
-        m_entities.push_back(ent);
-    }
-    m_newEntities.clear();
-    for (auto iter = m_entities.begin(); iter != m_entities.end();)
-    {
-        Entity* gameObject = *iter;
-        if (gameObject->m_isDead && !gameObject->IsPlayer())
-        {
-            delete gameObject;
-            iter = m_entities.erase(iter);
-            continue;
-        }
-        if (iter == m_entities.end())
-        {
-            break;
-        }
-        ++iter;
-    }
-    
     EndGameIfTooFewPlayers();
     for (PlayerShip* player : m_players)
     {
         UpdatePlayerScoreDisplay(player);
     }
 
-    UpdatePlayerCameras();
     SetVortexPositions();
 }
 
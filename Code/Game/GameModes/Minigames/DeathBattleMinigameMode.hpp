@@ -20,7 +20,7 @@ public:
     //FUNCTIONS/////////////////////////////////////////////////////////////////////
     virtual void Initialize(const std::vector<PlayerShip*>& players);
     virtual void CleanUp();
-    virtual void Update(float deltaSeconds);
+    virtual void PostWorldStep(float deltaSeconds);
     virtual void RankPlayers() override;
     virtual Encounter* GetRandomMinorEncounter(const Vector2& center, float radius) override;
     void SetUpPlayerSpawnPoints();
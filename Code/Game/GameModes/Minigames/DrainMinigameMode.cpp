@@ -105,47 +105,8 @@ void DrainMinigameMode::RecordPlayerDeath(PlayerShip* ship)
 }
 
 //-----------------------------------------------------------------------------------
-void DrainMinigameMode::Update(float deltaSeconds)
+void DrainMinigameMode::PostWorldStep(float deltaSeconds)
 {
-    BaseMinigameMode::Update(deltaSeconds);
-    deltaSeconds = m_scaledDeltaSeconds;
-
-    if (!m_isPlaying)
-    {
-        return;
-    }
-    for (Entity* ent : m_entities)
-    {
-        ent->Update(deltaSeconds);
-        for (Entity* other : m_entities)
-        {
-            if ((ent != other) && (ent->IsCollidingWith(other)))
-            {
-                ent->ResolveCollision(other);
-            }
-        }
-    }
-    for (Entity* ent : m_newEntities)
-    {
-        m_entities.push_back(ent);
-    }
-    m_newEntities.clear();
-    for (auto iter = m_entities.begin(); iter != m_entities.end();)
-    {
-        Entity* gameObject = *iter;
-        if (gameObject->m_isDead && !gameObject->IsPlayer())
-        {
-            delete gameObject;
-            iter = m_entities.erase(iter);
-            continue;
-        }
-        if (iter == m_entities.end())
-        {
-            break;
-        }
-        ++iter;
-    }
-    
     bool shouldDrain = false;
     m_currentDrainInterval = Lerp(GetTimerSecondsElapsed() / m_gameLengthSeconds, DRAIN_INTERVAL_MIN, DRAIN_INTERVAL_MAX);
     m_currentDamagePerInterval = Lerp(GetTimerSecondsElapsed() / m_gameLengthSeconds, DRAIN_DAMAGE_PER_INTERVAL_MIN, DRAIN_DAMAGE_PER_INTERVAL_MAX);
@@ -166,8 +127,6 @@ void DrainMinigameMode::Update(float deltaSeconds)
             player->Drain(m_currentDamagePerInterval);
         }
     }
-
-    UpdatePlayerCameras();
 }
 
 //-----------------------------------------------------------------------------------
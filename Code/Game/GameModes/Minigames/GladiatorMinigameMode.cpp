@@ -69,8 +69,8 @@ void GladiatorMinigameMode::InitializePlayerData()
 //-----------------------------------------------------------------------------------
 void GladiatorMinigameMode::RecordPlayerKill(PlayerShip* killer, Ship* victimShip)
 {
-    PlayerShip* victim = dynamic_cast<PlayerShip*>(victimShip);
-    ASSERT_OR_DIE(victim, "Killed an AI ship during Gladiator (or null target killed), don't spawn those here please >:T");
+    ASSERT_OR_DIE(victimShip && victimShip->IsPlayer(), "Killed an AI ship during Gladiator (or null target killed), don't spawn those here please >:T");
+    PlayerShip* victim = static_cast<PlayerShip*>(victimShip);
     GladiatorStats* killerStats = static_cast<GladiatorStats*>(m_playerStats[killer]);
     GladiatorStats* victimStats = static_cast<GladiatorStats*>(m_playerStats[victim]);
     if (killerStats->m_isGladiator)
@@ -121,47 +121,8 @@ void GladiatorMinigameMode::UpdatePlayerScoreDisplay(PlayerShip* player)
 }
 
 //-----------------------------------------------------------------------------------
-void GladiatorMinigameMode::Update(float deltaSeconds)
+void GladiatorMinigameMode::PostWorldStep(float)
 {
-    BaseMinigameMode::Update(deltaSeconds);
-    deltaSeconds = m_scaledDeltaSeconds;
-
-    if (!m_isPlaying)
-    {
-        return;
-    }
-    for (Entity* ent : m_entities)
-    {
-        ent->Update(deltaSeconds);
-        for (Entity* other : m_entities)
-        {
-            if ((ent != other) && (ent->IsCollidingWith(other)))
-            {
-                ent->ResolveCollision(other);
-            }
-        }
-    }
-    for (Entity* ent : m_newEntities)
-    {
-        m_entities.push_back(ent);
-    }
-    m_newEntities.clear();
-    for (auto iter = m_entities.begin(); iter != m_entities.end();)
-    {
-        Entity* gameObject = *iter;
-        if (gameObject->m_isDead && !gameObject->IsPlayer())
-        {
-            delete gameObject;
-            iter = m_entities.erase(iter);
-            continue;
-        }
-        if (iter == m_entities.end())
-        {
-            break;
-        }
-        ++iter;
-    }
-
     for (PlayerShip* player : m_players)
     {
         UpdatePlayerScoreDisplay(player);
@@ -171,8 +132,6 @@ void GladiatorMinigameMode::Update(float deltaSeconds)
             ParticleSystem::PlayOneShotParticleEffect("Gladiator", TheGame::BACKGROUND_PARTICLES_BLOOM_LAYER, Transform2D(), &(player->m_transform));
         }
     }
-
-    UpdatePlayerCameras();
 }
 
 //-----------------------------------------------------------------------------------
@@ -21,7 +21,7 @@ public:
     //FUNCTIONS/////////////////////////////////////////////////////////////////////
     virtual void Initialize(const std::vector<PlayerShip*>& players);
     virtual void CleanUp();
-    virtual void Update(float deltaSeconds);
+    virtual void PostWorldStep(float deltaSeconds);
     virtual void InitializePlayerData() override;
     virtual void RecordPlayerKill(PlayerShip* killer, Ship* victim) override;
     virtual Encounter* GetRandomMinorEncounter(const Vector2& center, float radius) override;
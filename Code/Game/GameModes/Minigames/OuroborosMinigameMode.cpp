@@ -178,16 +178,8 @@ void OuroborosMinigameMode::RankPlayers()
 }
 
 //-----------------------------------------------------------------------------------
-void OuroborosMinigameMode::Update(float deltaSeconds)
+void OuroborosMinigameMode::PreWorldStep(float deltaSeconds)
 {
-    BaseMinigameMode::Update(deltaSeconds);
-    deltaSeconds = m_scaledDeltaSeconds;
-
-    if (!m_isPlaying)
-    {
-        return;
-    }
-
     m_timeSinceLastCoin += deltaSeconds;
     if (m_timeSinceLastCoin > SECONDS_BETWEEN_COIN_SPAWNS)
     {
@@ -207,45 +199,15 @@ void OuroborosMinigameMode::Update(float deltaSeconds)
 
         m_timeSinceLastCoin = 0.0f;
     }
+}
 
-    for (Entity* ent : m_entities)
-    {
-        ent->Update(deltaSeconds);
-        for (Entity* other : m_entities)
-        {
-            if ((ent != other) && (ent->IsCollidingWith(other)))
-            {
-                ent->ResolveCollision(other);
-            }
-        }
-    }
-    for (Entity* ent : m_newEntities)
-    {
-        m_entities.push_back(ent);
-    }
-    m_newEntities.clear();
-    for (auto iter = m_entities.begin(); iter != m_entities.end();)
-    {
-        Entity* gameObject = *iter;
-        if (gameObject->m_isDead && !gameObject->IsPlayer())
-        {
-            delete gameObject;
-            iter = m_entities.erase(iter);
-            continue;
-        }
-        if (iter == m_entities.end())
-        {
-            break;
-        }
-        ++iter;
-    }
-
+//-----------------------------------------------------------------------------------
+void OuroborosMinigameMode::PostWorldStep(float)
+{
     for (PlayerShip* player : m_players)
     {
         UpdatePlayerScoreDisplay(player);
     }
-
-    UpdatePlayerCameras();
 }
 
 //-----------------------------------------------------------------------------------
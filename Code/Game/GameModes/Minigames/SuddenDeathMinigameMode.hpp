@@ -11,7 +11,7 @@ public:
     //FUNCTIONS/////////////////////////////////////////////////////////////////////
     virtual void Initialize(const std::vector<PlayerShip*>& players);
     virtual void CleanUp();
-    virtual void Update(float deltaSeconds);
+    virtual void PostWorldStep(float deltaSeconds);
 
     virtual Encounter* GetRandomMinorEncounter(const Vector2& center, float radius) override;
     void SetUpPlayerSpawnPoints();
@@ -0,0 +1,138 @@
+#include "Game/GameModes/WorldTransformCache.hpp"
+#include "Game/Entities/Entity.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+
+//-----------------------------------------------------------------------------------
+void WorldTransformCache::Rebuild(const std::vector<Entity*>& entities)
+{
+    Clear();
+    for (Entity* ent : entities)
+    {
+        if (ent->m_transform.GetParent())
+        {
+            m_pendingChildren.push_back(ent);
+        }
+        else
+        {
+            AddEntry(ent, NO_PARENT);
+        }
+    }
+
+    //Parented entities are rare, so they're the only time we pay for a lookup. Children are placed a level
+    //at a time once their parent has a slot. Anything parented to a non-entity is treated as a root.
+    if (!m_pendingChildren.empty())
+    {
+        for (unsigned int i = 0; i < m_owners.size(); ++i)
+        {
+            m_indicesByTransform[m_transforms[i]] = i;
+        }
+        for (Entity* ent : m_pendingChildren)
+        {
+            m_indicesByTransform[&ent->m_transform] = NO_PARENT;
+        }
+        while (!m_pendingChildren.empty())
+        {
+            m_nextPendingChildren.clear();
+            for (Entity* ent : m_pendingChildren)
+            {
+                auto found = m_indicesByTransform.find(ent->m_transform.GetParent());
+                if (found == m_indicesByTransform.end())
+                {
+                    AddEntry(ent, NO_PARENT);
+                }
+                else if (found->second != NO_PARENT)
+                {
+                    AddEntry(ent, found->second);
+                }
+                else
+                {
+                    m_nextPendingChildren.push_back(ent);
+                }
+            }
+            ASSERT_OR_DIE(m_nextPendingChildren.size() < m_pendingChildren.size(), "Entity transforms are parented in a loop");
+            m_pendingChildren.swap(m_nextPendingChildren);
+        }
+    }
+
+    const unsigned int numEntries = m_owners.size();
+    for (unsigned int i = 0; i < numEntries; ++i)
+    {
+        m_worldPositions[i] = m_transforms[i]->GetWorldPosition();
+    }
+}
+
+//-----------------------------------------------------------------------------------
+void WorldTransformCache::AddEntry(Entity* owner, unsigned int parentIndex)
+{
+    unsigned int index = m_owners.size();
+    if (!m_indicesByTransform.empty())
+    {
+        m_indicesByTransform[&owner->m_transform] = index;
+    }
+    m_owners.push_back(owner);
+    m_transforms.push_back(&owner->m_transform);
+    m_parentIndices.push_back(parentIndex);
+    m_numChildren.push_back(0);
+    m_worldPositions.push_back(Vector2::ZERO);
+    m_isDirty.push_back(0);
+    if (parentIndex != NO_PARENT)
+    {
+        ++m_numChildren[parentIndex];
+    }
+    owner->m_transformCache = this;
+    owner->m_transformCacheIndex = index;
+}
+
+//-----------------------------------------------------------------------------------
+//Players outlive the mode that cached them, so every owner still around is pointed back at its own transform.
+void WorldTransformCache::Clear()
+{
+    for (Entity* owner : m_owners)
+    {
+        if (owner && owner->m_transformCache == this)
+        {
+            owner->m_transformCache = nullptr;
+        }
+    }
+    m_owners.clear();
+    m_transforms.clear();
+    m_parentIndices.clear();
+    m_numChildren.clear();
+    m_worldPositions.clear();
+    m_isDirty.clear();
+    m_pendingChildren.clear();
+    m_indicesByTransform.clear();
+}
+
+//-----------------------------------------------------------------------------------
+void WorldTransformCache::Forget(unsigned int index)
+{
+    m_owners[index] = nullptr;
+}
+
+//-----------------------------------------------------------------------------------
+//Children always come after their parent, so one forward pass from the parent reaches every descendant.
+void WorldTransformCache::MarkDirty(unsigned int index)
+{
+    m_isDirty[index] = 1;
+    if (m_numChildren[index] == 0)
+    {
+        return;
+    }
+    const unsigned int numEntries = m_owners.size();
+    for (unsigned int i = index + 1; i < numEntries; ++i)
+    {
+        unsigned int parentIndex = m_parentIndices[i];
+        if (parentIndex != NO_PARENT && m_isDirty[parentIndex])
+        {
+            m_isDirty[i] = 1;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------------
+void WorldTransformCache::Recompute(unsigned int index)
+{
+    m_worldPositions[index] = m_transforms[index]->GetWorldPosition();
+    m_isDirty[index] = 0;
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include "Engine/Math/Vector2.hpp"
+#include <vector>
+#include <unordered_map>
+
+class Entity;
+class Transform2D;
+
+//Flat copy of every entity's world position, rebuilt once per step with parents ordered before their children.
+//Anything that moves an entity's transform marks its slot dirty, and the slot (plus any children) is recomputed on the next read.
+//-----------------------------------------------------------------------------------
+class WorldTransformCache
+{
+public:
+    //CONSTRUCTORS/////////////////////////////////////////////////////////////////////
+    WorldTransformCache() {};
+    ~WorldTransformCache() { Clear(); };
+
+    //FUNCTIONS/////////////////////////////////////////////////////////////////////
+    void Rebuild(const std::vector<Entity*>& entities);
+    void Clear();
+    void Forget(unsigned int index);
+    void MarkDirty(unsigned int index);
+    inline const Vector2& GetWorldPosition(unsigned int index) { if (m_isDirty[index]) { Recompute(index); } return m_worldPositions[index]; };
+    inline unsigned int GetNumEntries() const { return m_owners.size(); };
+
+    //CONSTANTS/////////////////////////////////////////////////////////////////////
+    static constexpr unsigned int NO_PARENT = 0xFFFFFFFF;
+
+private:
+    void AddEntry(Entity* owner, unsigned int parentIndex);
+    void Recompute(unsigned int index);
+
+    //MEMBER VARIABLES/////////////////////////////////////////////////////////////////////
+    std::vector<Entity*> m_owners;
+    std::vector<const Transform2D*> m_transforms;
+    std::vector<unsigned int> m_parentIndices;
+    std::vector<unsigned int> m_numChildren;
+    std::vector<Vector2> m_worldPositions;
+    std::vector<unsigned char> m_isDirty; //Bytes rather than bits, so entities updating in parallel can each mark their own slot.
+    std::vector<Entity*> m_pendingChildren;
+    std::vector<Entity*> m_nextPendingChildren;
+    std::unordered_map<const Transform2D*, unsigned int> m_indicesByTransform;
+};
@@ -43,13 +43,15 @@ void QuickshotActive::Activate(NamedProperties& parameters)
 {
     if (CanActivate())
     {
+        Ship* ship = nullptr;
+        ASSERT_OR_DIE(parameters.Get<Ship*>("ShipPtr", ship) == PGR_SUCCESS, "Wasn't able to grab the ship when activating a passive effect.");
+        m_owner = ship;
         m_statBonuses.rateOfFire = 10.0f;
+        ship->InvalidateStatValues();
         m_isActive = true;
         m_lastActivatedMiliseconds = GetCurrentTimeMilliseconds();
         m_energy -= m_costToActivate;
 
-        Ship* ship = nullptr;
-        ASSERT_OR_DIE(parameters.Get<Ship*>("ShipPtr", ship) == PGR_SUCCESS, "Wasn't able to grab the ship when activating a passive effect.");
         ParticleSystem::PlayOneShotParticleEffect("Buff", TheGame::BACKGROUND_PARTICLES_BLOOM_LAYER, Transform2D(), &ship->m_transform);
     }
 }
@@ -59,6 +61,10 @@ void QuickshotActive::Deactivate(NamedProperties& parameters)
 {
     UNUSED(parameters);
     m_statBonuses.rateOfFire = 0.0f;
+    if (m_owner)
+    {
+        m_owner->InvalidateStatValues();
+    }
     m_isActive = false;
 }
 
@@ -17,6 +17,7 @@ public:
     virtual const SpriteResource* GetSpriteResource();
 
     //MEMBER VARIABLES/////////////////////////////////////////////////////////////////////
+    Ship* m_owner = nullptr;
     static const double SECONDS_DURATION;
     static const double MILISECONDS_DURATION;
 };
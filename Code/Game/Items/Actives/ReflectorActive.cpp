@@ -50,18 +50,15 @@ void ReflectorActive::Activate(NamedProperties& parameters)
 
         Ship* ship = nullptr;
         ASSERT_OR_DIE(parameters.Get<Ship*>("ShipPtr", ship) == PGR_SUCCESS, "Wasn't able to grab the ship when activating a passive effect.");
-        std::vector<Entity*> nearbyEntities = GameMode::GetCurrent()->GetEntitiesInRadiusSquared(ship->GetPosition(), 9.0f);
-        for (Entity* entity : nearbyEntities)
+        EntityFilter filter(CollisionLayers::GetCategoryBit(PROJECTILE_CATEGORY), ship);
+        GameMode::GetCurrent()->ForEachEntityInCircle(ship->GetPosition(), REFLECTION_RADIUS, filter, [&](Entity* entity)
         {
-            if (entity->IsProjectile() && entity->m_owner != ship)
-            {
-                Projectile* projectile = (Projectile*)entity;
-                projectile->m_owner = ship;
-                projectile->m_velocity = -projectile->m_velocity;
-                projectile->m_damage *= 1.25f;
-                projectile->m_age = 0.0f;
-            }
-        }
+            Projectile* projectile = (Projectile*)entity;
+            projectile->m_owner = ship->m_handle;
+            projectile->m_velocity = -projectile->m_velocity;
+            projectile->m_damage *= 1.25f;
+            projectile->m_age = 0.0f;
+        });
 
         ParticleSystem::PlayOneShotParticleEffect("Reflector", TheGame::BACKGROUND_PARTICLES_BLOOM_LAYER, Transform2D(), &ship->m_transform);
     }
@@ -19,6 +19,7 @@ public:
     //MEMBER VARIABLES/////////////////////////////////////////////////////////////////////
     static const double SECONDS_DURATION;
     static const double MILISECONDS_DURATION;
+    static constexpr float REFLECTION_RADIUS = 3.0f;
 };
 
 
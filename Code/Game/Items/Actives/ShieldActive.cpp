@@ -43,17 +43,19 @@ void ShieldActive::Activate(NamedProperties& parameters)
 {
     if (CanActivate())
     {
+        Ship* ship = nullptr;
+        ASSERT_OR_DIE(parameters.Get<Ship*>("ShipPtr", ship) == PGR_SUCCESS, "Wasn't able to grab the ship when activating a passive effect.");
+        m_owner = ship;
         m_statBonuses.shotDeflection = 30.0f;
         m_statBonuses.shieldRegen = 30.0f;
         m_statBonuses.shieldCapacity = 10.0f;
+        ship->InvalidateStatValues();
         m_isActive = true;
         m_lastActivatedMiliseconds = GetCurrentTimeMilliseconds();
         m_energy -= m_costToActivate;
 
-        Ship* ship = nullptr;
-        ASSERT_OR_DIE(parameters.Get<Ship*>("ShipPtr", ship) == PGR_SUCCESS, "Wasn't able to grab the ship when activating a passive effect.");
         ship->m_timeSinceLastHit = Ship::SECONDS_BEFORE_SHIELD_REGEN_RESTARTS;
-        ship->SetShieldHealth(ship->m_currentShieldHealth + (ship->CalculateShieldCapacityValue() * 0.5f));
+        ship->SetShieldHealth(ship->m_loadout->m_currentShieldHealth + (ship->GetShieldCapacityValue() * 0.5f));
         ParticleSystem::PlayOneShotParticleEffect("Forcefield", TheGame::BACKGROUND_PARTICLES_BLOOM_LAYER, Transform2D(), &ship->m_transform);
     }
 }
@@ -65,6 +67,10 @@ void ShieldActive::Deactivate(NamedProperties& parameters)
     m_statBonuses.shotDeflection = 0.0f;
     m_statBonuses.shieldRegen = 0.0f;
     m_statBonuses.shieldCapacity = 0.0f;
+    if (m_owner)
+    {
+        m_owner->InvalidateStatValues();
+    }
     m_isActive = false;
 }
 
@@ -31,8 +31,12 @@ void TeleportActive::Update(float deltaSeconds)
     {
         if (GetCurrentTimeMilliseconds() - m_lastActivatedMiliseconds > MILISECONDS_UNTIL_WARP)
         {
-            ParticleSystem::PlayOneShotParticleEffect("Warped", TheGame::BACKGROUND_PARTICLES_BLOOM_LAYER, Transform2D(), &m_transportee->m_transform);
-            m_transportee->SetPosition(GameMode::GetCurrent()->GetRandomLocationInArena());
+            Ship* transportee = EntityRegistry::instance->ResolveAs<Ship>(m_transportee);
+            if (transportee)
+            {
+                ParticleSystem::PlayOneShotParticleEffect("Warped", TheGame::BACKGROUND_PARTICLES_BLOOM_LAYER, Transform2D(), &transportee->m_transform);
+                transportee->SetPosition(GameMode::GetCurrent()->GetRandomLocationInArena());
+            }
             Deactivate(NamedProperties::NONE);
         }
     }
@@ -48,13 +52,15 @@ void TeleportActive::Activate(NamedProperties& parameters)
     static SoundID warpingSound = AudioSystem::instance->CreateOrGetSound("Data/SFX/teleport.ogg");
     if (CanActivate())
     {
-        ASSERT_OR_DIE(parameters.Get<Ship*>("ShipPtr", m_transportee) == PGR_SUCCESS, "Wasn't able to grab the ship when activating a passive effect.");
+        Ship* transportee = nullptr;
+        ASSERT_OR_DIE(parameters.Get<Ship*>("ShipPtr", transportee) == PGR_SUCCESS, "Wasn't able to grab the ship when activating a passive effect.");
+        m_transportee = transportee->m_handle;
         m_lastActivatedMiliseconds = GetCurrentTimeMilliseconds();
         m_isActive = true;
         m_energy = m_energy - m_costToActivate;
 
-        ParticleSystem::PlayOneShotParticleEffect("Warping", TheGame::BACKGROUND_PARTICLES_BLOOM_LAYER, Transform2D(), &m_transportee->m_transform);
-        GameMode::GetCurrent()->PlaySoundAt(warpingSound, m_transportee->GetPosition(), TheGame::TELEPORT_VOLUME, MathUtils::GetRandomFloat(0.9f, 1.1f));
+        ParticleSystem::PlayOneShotParticleEffect("Warping", TheGame::BACKGROUND_PARTICLES_BLOOM_LAYER, Transform2D(), &transportee->m_transform);
+        GameMode::GetCurrent()->PlaySoundAt(warpingSound, transportee->GetPosition(), TheGame::TELEPORT_VOLUME, MathUtils::GetRandomFloat(0.9f, 1.1f));
     }
 }
 
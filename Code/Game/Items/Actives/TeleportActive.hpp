@@ -1,5 +1,6 @@
 #pragma once
 #include "Game/Items/Actives/ActiveEffect.hpp"
+#include "Game/Entities/EntityRegistry.hpp"
 
 class Ship;
 
@@ -17,7 +18,7 @@ public:
     virtual const SpriteResource* GetSpriteResource();
 
     //MEMBER VARIABLES/////////////////////////////////////////////////////////////////////
-    Ship* m_transportee = nullptr;
+    EntityHandle m_transportee; //The ship can be deleted before a delayed warp lands.
 
     static const double SECONDS_UNTIL_WARP;
     static const double MILISECONDS_UNTIL_WARP;
@@ -33,10 +33,14 @@ void WarpActive::Update(float deltaSeconds)
     {
         if (GetCurrentTimeMilliseconds() - m_lastActivatedMiliseconds > MILISECONDS_UNTIL_WARP)
         {
-            ParticleSystem::PlayOneShotParticleEffect("Warped", TheGame::BACKGROUND_PARTICLES_BLOOM_LAYER, Transform2D(), &m_transportee->m_transform);
-            Pilot* pilot = m_transportee->m_pilot;
-            Vector2 jumpedPosition = m_transportee->GetPosition() + pilot->m_inputMap.GetVector2("Right", "Up") * 5.0f;
-            m_transportee->SetPosition(jumpedPosition);
+            Ship* transportee = EntityRegistry::instance->ResolveAs<Ship>(m_transportee);
+            if (transportee)
+            {
+                ParticleSystem::PlayOneShotParticleEffect("Warped", TheGame::BACKGROUND_PARTICLES_BLOOM_LAYER, Transform2D(), &transportee->m_transform);
+                Pilot* pilot = transportee->m_pilot;
+                Vector2 jumpedPosition = transportee->GetPosition() + pilot->GetVector2(RIGHT_AXIS, UP_AXIS) * 5.0f;
+                transportee->SetPosition(jumpedPosition);
+            }
             Deactivate(NamedProperties::NONE);
         }
     }
@@ -52,14 +56,16 @@ void WarpActive::Activate(NamedProperties& parameters)
     static SoundID warpingSound = AudioSystem::instance->CreateOrGetSound("Data/SFX/swapDimensions.wav");
     if (CanActivate())
     {
-        ASSERT_OR_DIE(parameters.Get<Ship*>("ShipPtr", m_transportee) == PGR_SUCCESS, "Wasn't able to grab the ship when activating a passive effect.");
+        Ship* transportee = nullptr;
+        ASSERT_OR_DIE(parameters.Get<Ship*>("ShipPtr", transportee) == PGR_SUCCESS, "Wasn't able to grab the ship when activating a passive effect.");
+        m_transportee = transportee->m_handle;
         m_lastActivatedMiliseconds = GetCurrentTimeMilliseconds();
         m_isActive = true;
         m_energy = m_energy - m_costToActivate;
 
-        ParticleSystem::PlayOneShotParticleEffect("Warping", TheGame::BACKGROUND_PARTICLES_BLOOM_LAYER, Transform2D(), &m_transportee->m_transform);
-        GameMode::GetCurrent()->PlaySoundAt(warpingSound, m_transportee->GetPosition(), TheGame::TELEPORT_VOLUME, MathUtils::GetRandomFloat(0.9f, 1.1f));
-        m_transportee->m_collisionDamageAmount += WARP_DAMAGE_PER_FRAME;
+        ParticleSystem::PlayOneShotParticleEffect("Warping", TheGame::BACKGROUND_PARTICLES_BLOOM_LAYER, Transform2D(), &transportee->m_transform);
+        GameMode::GetCurrent()->PlaySoundAt(warpingSound, transportee->GetPosition(), TheGame::TELEPORT_VOLUME, MathUtils::GetRandomFloat(0.9f, 1.1f));
+        transportee->m_collisionDamageAmount += WARP_DAMAGE_PER_FRAME;
     }
 }
 
@@ -67,12 +73,18 @@ void WarpActive::Activate(NamedProperties& parameters)
 void WarpActive::Deactivate(NamedProperties& parameters)
 {
     UNUSED(parameters);
+    EntityHandle transporteeHandle = m_transportee;
     RunAfterSeconds([=]()
     {
-        m_transportee->m_collisionDamageAmount -= WARP_DAMAGE_PER_FRAME;
-        if (fabs(m_transportee->m_collisionDamageAmount) < 0.25f)
+        Ship* transportee = EntityRegistry::instance->ResolveAs<Ship>(transporteeHandle);
+        if (!transportee)
         {
-            m_transportee->m_collisionDamageAmount = 0.0f;
+            return;
+        }
+        transportee->m_collisionDamageAmount -= WARP_DAMAGE_PER_FRAME;
+        if (fabs(transportee->m_collisionDamageAmount) < 0.25f)
+        {
+            transportee->m_collisionDamageAmount = 0.0f;
         }
     }, 0.0f);
     m_isActive = false;
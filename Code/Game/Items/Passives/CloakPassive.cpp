@@ -30,7 +30,7 @@ void CloakPassive::Update(float deltaSeconds)
     float alphaValue = Clamp<float>(squaredMagnitude / SPEED_THRESHOLD_FOR_CLOAK_SQUARED, 0.0f, 1.0f);
     m_owner->m_stealthFactor = std::max(m_owner->m_stealthFactor, 1.0f - alphaValue);
     m_owner->m_sprite->m_tintColor.SetAlphaFloat(alphaValue);
-    m_owner->m_shieldSprite->m_tintColor.SetAlphaFloat(Min<float>(alphaValue, m_owner->m_shieldSprite->m_tintColor.GetAlphaFloat()));
+    m_owner->m_loadout->m_shieldSprite->m_tintColor.SetAlphaFloat(Min<float>(alphaValue, m_owner->m_loadout->m_shieldSprite->m_tintColor.GetAlphaFloat()));
 
     if (!GameMode::GetCurrent()->m_isPlaying)
     {
@@ -50,7 +50,7 @@ void CloakPassive::Deactivate(NamedProperties& parameters)
 {
     UNUSED(parameters);
     m_owner->m_sprite->m_tintColor.SetAlphaFloat(1.0f);
-    m_owner->m_shieldSprite->m_tintColor.SetAlphaFloat(1.0f);
+    m_owner->m_loadout->m_shieldSprite->m_tintColor.SetAlphaFloat(1.0f);
     m_owner->m_shipTrail->m_colorOverride.SetAlphaFloat(1.0f);
     m_owner->m_shipTrail->m_colorOverride.SetAlphaFloat(1.0f);
 }
@@ -183,5 +183,6 @@ const char* PowerUp::GetPowerUpSpriteResourceName(PowerUpType type)
 void PowerUp::ApplyPickupEffect(PlayerShip* player)
 {
     player->m_powerupStatModifiers += m_statChanges;
+    player->InvalidateStatValues();
 }
 
@@ -36,7 +36,7 @@ bool LaserGun::AttemptFire(Ship* shooter)
     static float SECONDS_TO_RUMBLE = 0.075f;
     static const SoundID bulletSound = AudioSystem::instance->CreateOrGetSound("Data/SFX/Bullets/SFX_Weapon_Fire_Single_02.wav");
     bool successfullyFired = false;
-    float secondsPerWeaponFire = 1.0f / shooter->CalculateRateOfFireValue();
+    float secondsPerWeaponFire = 1.0f / shooter->GetRateOfFireValue();
 
     if (shooter->m_secondsSinceLastFiredWeapon > secondsPerWeaponFire)
     {
@@ -44,7 +44,7 @@ bool LaserGun::AttemptFire(Ship* shooter)
 
         float halfSpreadDegrees = m_spreadDegrees / 2.0f;
         float degreesOffset = MathUtils::GetRandomFloat(-halfSpreadDegrees, halfSpreadDegrees);
-        Projectile* bullet = (Projectile*)new Laser(shooter, degreesOffset, shooter->CalculateDamageValue(), shooter->CalculateShieldDisruptionValue(), shooter->CalculateShotHomingValue());
+        Projectile* bullet = (Projectile*)new Laser(shooter, degreesOffset, shooter->GetDamageValue(), shooter->GetShieldDisruptionValue(), shooter->GetShotHomingValue());
 
         if (shooter->IsPlayer())
         {
@@ -45,7 +45,7 @@ bool MissileLauncher::AttemptFire(Ship* shooter)
 
     SoundID bulletSound = bulletSounds[MathUtils::GetRandomIntFromZeroTo(NUM_SOUNDS)];
     bool successfullyFired = false;
-    float secondsPerWeaponFire = 1.0f / shooter->CalculateRateOfFireValue();
+    float secondsPerWeaponFire = 1.0f / shooter->GetRateOfFireValue();
 
     if (shooter->m_secondsSinceLastFiredWeapon > secondsPerWeaponFire)
     {
@@ -55,7 +55,7 @@ bool MissileLauncher::AttemptFire(Ship* shooter)
         {
             float halfSpreadDegrees = m_spreadDegrees / 2.0f;
             float degreesOffset = MathUtils::GetRandomFloat(-halfSpreadDegrees, halfSpreadDegrees);
-            Projectile* bullet = (Projectile*)new Missile(shooter, degreesOffset, shooter->CalculateDamageValue(), shooter->CalculateShieldDisruptionValue(), shooter->CalculateShotHomingValue());
+            Projectile* bullet = (Projectile*)new Missile(shooter, degreesOffset, shooter->GetDamageValue(), shooter->GetShieldDisruptionValue(), shooter->GetShotHomingValue());
             if (shooter->IsPlayer())
             {
                 bullet->m_reportDPSToPlayer = true;
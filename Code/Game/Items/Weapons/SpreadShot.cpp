@@ -38,7 +38,7 @@ bool SpreadShot::AttemptFire(Ship* shooter)
     static float RUMBLE_PERCENTAGE = 0.1f;
     static float SECONDS_TO_RUMBLE = 0.075f;
     bool successfullyFired = false;
-    float secondsPerWeaponFire = 1.0f / shooter->CalculateRateOfFireValue();
+    float secondsPerWeaponFire = 1.0f / shooter->GetRateOfFireValue();
 
     if (shooter->m_secondsSinceLastFiredWeapon > secondsPerWeaponFire)
     {
@@ -48,7 +48,7 @@ bool SpreadShot::AttemptFire(Ship* shooter)
         for (unsigned int i = 0; i < m_numProjectilesPerShot; ++i)
         {
             float degreesOffset = MathUtils::GetRandomFloat(-halfSpreadDegrees, halfSpreadDegrees);
-            Projectile* bullet = (Projectile*)new Laser(shooter, degreesOffset, shooter->CalculateDamageValue(), shooter->CalculateShieldDisruptionValue(), shooter->CalculateShotHomingValue());
+            Projectile* bullet = (Projectile*)new Laser(shooter, degreesOffset, shooter->GetDamageValue(), shooter->GetShieldDisruptionValue(), shooter->GetShotHomingValue());
             bullet->m_lifeSpan = LIFE_SPAN_PER_PROJECTILE;
             currentGameMode->SpawnBullet(bullet);
             if (shooter->IsPlayer())
@@ -48,7 +48,7 @@ bool WaveGun::AttemptFire(Ship* shooter)
 
 
     bool successfullyFired = false;
-    float secondsPerWeaponFire = 1.0f / shooter->CalculateRateOfFireValue();
+    float secondsPerWeaponFire = 1.0f / shooter->GetRateOfFireValue();
 
     if (shooter->m_secondsSinceLastFiredWeapon > secondsPerWeaponFire)
     {
@@ -58,9 +58,9 @@ bool WaveGun::AttemptFire(Ship* shooter)
         for (unsigned int i = 0; i < m_numProjectilesPerShot; ++i)
         {
             float degreesOffset = MathUtils::GetRandomFloat(-halfSpreadDegrees, halfSpreadDegrees);
-            Projectile* bullet = (Projectile*)new PlasmaBall(shooter, degreesOffset, shooter->CalculateDamageValue(), shooter->CalculateShieldDisruptionValue(), shooter->CalculateShotHomingValue());
-            Projectile* leftBullet = (Projectile*)new PlasmaBall(shooter, degreesOffset, shooter->CalculateDamageValue(), shooter->CalculateShieldDisruptionValue(), shooter->CalculateShotHomingValue(), PlasmaBall::LEFT_WAVE);
-            Projectile* rightBullet = (Projectile*)new PlasmaBall(shooter, degreesOffset, shooter->CalculateDamageValue(), shooter->CalculateShieldDisruptionValue(), shooter->CalculateShotHomingValue(), PlasmaBall::RIGHT_WAVE);
+            Projectile* bullet = (Projectile*)new PlasmaBall(shooter, degreesOffset, shooter->GetDamageValue(), shooter->GetShieldDisruptionValue(), shooter->GetShotHomingValue());
+            Projectile* leftBullet = (Projectile*)new PlasmaBall(shooter, degreesOffset, shooter->GetDamageValue(), shooter->GetShieldDisruptionValue(), shooter->GetShotHomingValue(), PlasmaBall::LEFT_WAVE);
+            Projectile* rightBullet = (Projectile*)new PlasmaBall(shooter, degreesOffset, shooter->GetDamageValue(), shooter->GetShieldDisruptionValue(), shooter->GetShotHomingValue(), PlasmaBall::RIGHT_WAVE);
             currentGameMode->SpawnBullet(bullet);
             currentGameMode->SpawnBullet(leftBullet);
             currentGameMode->SpawnBullet(rightBullet);
@@ -0,0 +1,83 @@
+#include "Game/LinearArena.hpp"
+
+std::vector<unsigned char*> LinearArena::s_cachedPages;
+
+//-----------------------------------------------------------------------------------
+LinearArena::LinearArena()
+{
+}
+
+//-----------------------------------------------------------------------------------
+LinearArena::~LinearArena()
+{
+    Reset();
+}
+
+//-----------------------------------------------------------------------------------
+void* LinearArena::Allocate(size_t size)
+{
+    size_t alignedSize = (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+
+    if (alignedSize > PAGE_SIZE)
+    {
+        //Oversized blocks get a page of their own and leave the current page alone.
+        Page page;
+        page.m_memory = new unsigned char[alignedSize];
+        page.m_size = alignedSize;
+        m_pages.insert(m_pages.end() - (m_pages.empty() ? 0 : 1), page);
+        m_numBytesUsed += alignedSize;
+        return page.m_memory;
+    }
+
+    if (m_pageOffset + alignedSize > PAGE_SIZE)
+    {
+        Page page;
+        page.m_size = PAGE_SIZE;
+        if (!s_cachedPages.empty())
+        {
+            page.m_memory = s_cachedPages.back();
+            s_cachedPages.pop_back();
+        }
+        else
+        {
+            page.m_memory = new unsigned char[PAGE_SIZE];
+        }
+        m_pages.push_back(page);
+        m_pageOffset = 0;
+    }
+
+    void* storage = m_pages.back().m_memory + m_pageOffset;
+    m_pageOffset += alignedSize;
+    m_numBytesUsed += alignedSize;
+    return storage;
+}
+
+//Hands every page back at once. Anything still pointing into the arena is dangling after this.
+//-----------------------------------------------------------------------------------
+void LinearArena::Reset()
+{
+    for (const Page& page : m_pages)
+    {
+        if (page.m_size == PAGE_SIZE && s_cachedPages.size() < MAX_CACHED_PAGES)
+        {
+            s_cachedPages.push_back(page.m_memory);
+        }
+        else
+        {
+            delete[] page.m_memory;
+        }
+    }
+    m_pages.clear();
+    m_pageOffset = PAGE_SIZE;
+    m_numBytesUsed = 0;
+}
+
+//-----------------------------------------------------------------------------------
+void LinearArena::ClearPageCache()
+{
+    for (unsigned char* page : s_cachedPages)
+    {
+        delete[] page;
+    }
+    s_cachedPages.clear();
+}
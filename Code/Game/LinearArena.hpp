@@ -0,0 +1,43 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+
+//Bump allocator owned by a game mode. There are no individual frees; Reset() reclaims everything at once
+//without running destructors, so only types whose destructors own nothing belong in here.
+//Reset pages go to a shared cache so the next mode starts on warm memory. Main thread only.
+//-----------------------------------------------------------------------------------
+class LinearArena
+{
+public:
+    //CONSTRUCTORS/////////////////////////////////////////////////////////////////////
+    LinearArena();
+    ~LinearArena();
+
+    //FUNCTIONS/////////////////////////////////////////////////////////////////////
+    void* Allocate(size_t size);
+    void Reset();
+    inline size_t GetNumBytesUsed() const { return m_numBytesUsed; };
+
+    //STATIC FUNCTIONS/////////////////////////////////////////////////////////////////////
+    static void ClearPageCache();
+
+private:
+    struct Page
+    {
+        unsigned char* m_memory;
+        size_t m_size;
+    };
+
+    //CONSTANTS/////////////////////////////////////////////////////////////////////
+    static constexpr size_t PAGE_SIZE = 64 * 1024;
+    static constexpr size_t ALIGNMENT = 16;
+    static constexpr unsigned int MAX_CACHED_PAGES = 64;
+
+    //MEMBER VARIABLES/////////////////////////////////////////////////////////////////////
+    std::vector<Page> m_pages;
+    size_t m_pageOffset = PAGE_SIZE;
+    size_t m_numBytesUsed = 0;
+
+    //STATIC VARIABLES/////////////////////////////////////////////////////////////////////
+    static std::vector<unsigned char*> s_cachedPages;
+};
@@ -0,0 +1,40 @@
+#include "Game/ObjectPool.hpp"
+#include "Engine/Core/ProfilingUtils.h"
+
+ObjectPoolBase* ObjectPoolBase::s_firstPool = nullptr;
+
+//-----------------------------------------------------------------------------------
+ObjectPoolBase::ObjectPoolBase(const char* name)
+    : m_name(name)
+    , m_nextPool(s_firstPool)
+{
+    s_firstPool = this;
+}
+
+//-----------------------------------------------------------------------------------
+ObjectPoolBase::~ObjectPoolBase()
+{
+    ObjectPoolBase** link = &s_firstPool;
+    while (*link && *link != this)
+    {
+        link = &(*link)->m_nextPool;
+    }
+    if (*link)
+    {
+        *link = m_nextPool;
+    }
+}
+
+//Called once a frame; the counters show up under each pool's name in the profiler's report.
+//-----------------------------------------------------------------------------------
+void ObjectPoolBase::ReportToProfiler()
+{
+#ifdef PROFILING_ENABLED
+    for (ObjectPoolBase* pool = s_firstPool; pool; pool = pool->m_nextPool)
+    {
+        ProfilingSystem::instance->ReportCounter(pool->m_name, "Live", pool->m_numLive);
+        ProfilingSystem::instance->ReportCounter(pool->m_name, "HighWater", pool->m_highWaterMark);
+        ProfilingSystem::instance->ReportCounter(pool->m_name, "Capacity", pool->m_capacity);
+    }
+#endif
+}
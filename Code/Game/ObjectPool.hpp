@@ -0,0 +1,131 @@
+#pragma once
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include <vector>
+#include <mutex>
+
+//Bookkeeping shared by every pool so their usage can be reported to the profiler together.
+//-----------------------------------------------------------------------------------
+class ObjectPoolBase
+{
+public:
+    //CONSTRUCTORS/////////////////////////////////////////////////////////////////////
+    ObjectPoolBase(const char* name);
+    virtual ~ObjectPoolBase();
+
+    //FUNCTIONS/////////////////////////////////////////////////////////////////////
+    inline const char* GetName() const { return m_name; };
+    inline unsigned int GetNumLive() const { return m_numLive; };
+    inline unsigned int GetHighWaterMark() const { return m_highWaterMark; };
+    inline unsigned int GetCapacity() const { return m_capacity; };
+
+    //STATIC FUNCTIONS/////////////////////////////////////////////////////////////////////
+    static void ReportToProfiler();
+
+protected:
+    //MEMBER VARIABLES/////////////////////////////////////////////////////////////////////
+    const char* m_name;
+    ObjectPoolBase* m_nextPool;
+    unsigned int m_numLive = 0;
+    unsigned int m_highWaterMark = 0;
+    unsigned int m_capacity = 0;
+
+    //STATIC VARIABLES/////////////////////////////////////////////////////////////////////
+    static ObjectPoolBase* s_firstPool;
+};
+
+//Typed free list of raw storage for T. Hook it up through T's class-specific operator new/delete,
+//so the existing new/delete call sites recycle memory and the constructor resets the reused object.
+//-----------------------------------------------------------------------------------
+template <typename T>
+class ObjectPool : public ObjectPoolBase
+{
+public:
+    //CONSTRUCTORS/////////////////////////////////////////////////////////////////////
+    ObjectPool(const char* name) : ObjectPoolBase(name) {};
+    virtual ~ObjectPool();
+
+    //FUNCTIONS/////////////////////////////////////////////////////////////////////
+    void* Allocate(size_t size);
+    void Free(void* storage);
+
+private:
+    union Block
+    {
+        Block* m_next;
+        alignas(T) unsigned char m_storage[sizeof(T)];
+    };
+
+    void AddPage();
+
+    //CONSTANTS/////////////////////////////////////////////////////////////////////
+    static constexpr unsigned int BLOCKS_PER_PAGE = 64;
+
+    //MEMBER VARIABLES/////////////////////////////////////////////////////////////////////
+    std::vector<Block*> m_pages;
+    Block* m_freeList = nullptr;
+    std::mutex m_mutex;
+};
+
+//-----------------------------------------------------------------------------------
+template <typename T>
+ObjectPool<T>::~ObjectPool()
+{
+    //Anything still alive at shutdown would be freed into a dead pool, so leak the pages instead.
+    if (m_numLive > 0)
+    {
+        return;
+    }
+    for (Block* page : m_pages)
+    {
+        delete[] page;
+    }
+}
+
+//-----------------------------------------------------------------------------------
+template <typename T>
+void* ObjectPool<T>::Allocate(size_t size)
+{
+    ASSERT_OR_DIE(size <= sizeof(T), "Pooled type was allocated as a larger derived class");
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_freeList)
+    {
+        AddPage();
+    }
+    Block* block = m_freeList;
+    m_freeList = block->m_next;
+    ++m_numLive;
+    if (m_numLive > m_highWaterMark)
+    {
+        m_highWaterMark = m_numLive;
+    }
+    return block->m_storage;
+}
+
+//-----------------------------------------------------------------------------------
+template <typename T>
+void ObjectPool<T>::Free(void* storage)
+{
+    if (!storage)
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Block* block = static_cast<Block*>(storage);
+    block->m_next = m_freeList;
+    m_freeList = block;
+    --m_numLive;
+}
+
+//-----------------------------------------------------------------------------------
+template <typename T>
+void ObjectPool<T>::AddPage()
+{
+    Block* page = new Block[BLOCKS_PER_PAGE];
+    m_pages.push_back(page);
+    for (unsigned int i = 0; i < BLOCKS_PER_PAGE; ++i)
+    {
+        page[i].m_next = (i + 1 < BLOCKS_PER_PAGE) ? &page[i + 1] : m_freeList;
+    }
+    m_freeList = page;
+    m_capacity += BLOCKS_PER_PAGE;
+}
@@ -1,6 +1,7 @@
 #include "Game/Pilots/BasicEnemyPilot.hpp"
 #include "../Entities/PlayerShip.hpp"
 #include "../TheGame.hpp"
+#include "Game/GameModes/GameMode.hpp"
 
 //-----------------------------------------------------------------------------------
 BasicEnemyPilot::BasicEnemyPilot()
@@ -11,6 +12,7 @@ BasicEnemyPilot::BasicEnemyPilot()
     m_inputMap.MapInputAxis("ShootRight")->AddMapping(&m_shooting.m_xAxis); 
     m_inputMap.MapInputValue("Shoot", ChordResolutionMode::RESOLVE_MAXS_ABSOLUTE);
     m_wanderDirection = MathUtils::GetRandomVectorInCircle(0.75f);
+    BindInputActions();
 }
 
 //-----------------------------------------------------------------------------------
@@ -28,59 +30,49 @@ void BasicEnemyPilot::Update(float deltaSeconds, Ship* currentShip)
         return;
     }
 
-    m_timeSinceRetargetSeconds += deltaSeconds;
-    m_timeSinceRewanderSeconds += deltaSeconds;
-
-    if (m_timeSinceRetargetSeconds > TIME_IN_BETWEEN_TARGETING_SECONDS)
+    if (!m_director)
     {
-        FindTarget();
-        m_timeSinceRetargetSeconds = 0.0f;
+        RegisterWithDirector(m_currentShip);
     }
+
+    m_timeSinceRewanderSeconds += deltaSeconds;
     if (m_timeSinceRewanderSeconds > TIME_IN_BETWEEN_WANDERING_SECONDS)
     {
         m_wanderDirection = MathUtils::GetRandomVectorInCircle(0.75f);
         m_timeSinceRewanderSeconds = MathUtils::GetRandomFloat(0.0f, 1.0f);
     }
 
-    if (m_currentTarget)
+    Ship* target = EntityRegistry::instance->ResolveAs<Ship>(m_currentTarget);
+    if (target)
     {
-        Vector2 deltaPosition = m_currentTarget->GetPosition() - m_currentShip->GetPosition();
+        Vector2 deltaPosition = target->GetPosition() - m_currentShip->GetPosition();
         Vector2 direction = deltaPosition.GetNorm();
 
-        m_inputMap.FindInputAxis("Right")->SetValue(direction.x);
-        m_inputMap.FindInputAxis("Up")->SetValue(direction.y);
-        m_inputMap.FindInputAxis("ShootUp")->SetValue(direction.y);
-        m_inputMap.FindInputAxis("ShootRight")->SetValue(direction.x);
-        m_inputMap.FindInputValue("Shoot")->SetValue(true);
+        //Fly the flow field around static props, but keep aiming straight at the target.
+        Vector2 moveDirection = direction;
+        m_director->GetFlowField().GetFlowDirection(m_currentTarget, m_currentShip->GetPosition(), moveDirection);
+
+        GetAxis(RIGHT_AXIS)->SetValue(moveDirection.x);
+        GetAxis(UP_AXIS)->SetValue(moveDirection.y);
+        GetAxis(SHOOT_UP_AXIS)->SetValue(direction.y);
+        GetAxis(SHOOT_RIGHT_AXIS)->SetValue(direction.x);
+        GetAction(SHOOT_ACTION)->SetValue(true);
     }
     else
     {
-        m_inputMap.FindInputAxis("Right")->SetValue(m_wanderDirection.x);
-        m_inputMap.FindInputAxis("Up")->SetValue(m_wanderDirection.y);
-        m_inputMap.FindInputAxis("ShootUp")->SetValue(0.0f);
-        m_inputMap.FindInputAxis("ShootRight")->SetValue(0.0f);
-        m_inputMap.FindInputValue("Shoot")->SetValue(false);
+        GetAxis(RIGHT_AXIS)->SetValue(m_wanderDirection.x);
+        GetAxis(UP_AXIS)->SetValue(m_wanderDirection.y);
+        GetAxis(SHOOT_UP_AXIS)->SetValue(0.0f);
+        GetAxis(SHOOT_RIGHT_AXIS)->SetValue(0.0f);
+        GetAction(SHOOT_ACTION)->SetValue(false);
     }
 }
 
+//Enemies can be spawned straight into a mode's entity list, so they sign up with their mode's director on their first update instead.
 //-----------------------------------------------------------------------------------
-void BasicEnemyPilot::FindTarget()
+void BasicEnemyPilot::RegisterWithDirector(Ship* currentShip)
 {
-    m_currentTarget = nullptr;
-    float bestDistSquared = 9999999.0f;
-    for (PlayerShip* player : TheGame::instance->m_players)
-    {
-        if (player->IsDead())
-        {
-            continue;
-        }
-
-        float distSquared = MathUtils::CalcDistSquaredBetweenPoints(player->GetPosition(), m_currentShip->GetPosition());
-        float detectionRadius = DETECTION_RADIUS_SQUARED * (Ship::MAX_STEALTH_FACTOR - player->m_stealthFactor);
-        if (distSquared < detectionRadius && distSquared < bestDistSquared)
-        {
-            bestDistSquared = distSquared;
-            m_currentTarget = player;
-        }
-    }
-}
\ No newline at end of file
+    GameMode* gameMode = currentShip->m_currentGameMode ? currentShip->m_currentGameMode : GameMode::GetCurrent();
+    m_director = &gameMode->m_enemyDirector;
+    m_director->AddEnemy(currentShip);
+}
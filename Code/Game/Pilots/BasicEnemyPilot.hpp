@@ -2,7 +2,9 @@
 #include "Engine\Input\InputMap.hpp"
 #include "Engine\Core\ErrorWarningAssert.hpp"
 #include "Pilot.hpp"
+#include "Game/Entities/EntityRegistry.hpp"
 class Ship;
+class EnemyDirector;
 
 class BasicEnemyPilot : public Pilot
 {
@@ -13,14 +15,14 @@ public:
 
     //FUNCTIONS/////////////////////////////////////////////////////////////////////
     virtual void Update(float deltaSeconds, Ship* currentShip);
-    virtual void FindTarget();
+    void RegisterWithDirector(Ship* currentShip);
 
     //MEMBER VARIABLES/////////////////////////////////////////////////////////////////////
-    float m_timeSinceRetargetSeconds = 0.0f;
     float m_timeSinceRewanderSeconds = 0.0f;
     float m_angularVelocity;
     Vector2 m_wanderDirection = Vector2::ZERO;
-    Ship* m_currentTarget = nullptr;
+    EntityHandle m_currentTarget; //Set by the EnemyDirector. Targets can die between retargets, so resolve this every frame.
+    EnemyDirector* m_director = nullptr;
     Ship* m_currentShip = nullptr;
     InputVector2 m_movement;
     InputVector2 m_shooting;
@@ -1,9 +1,24 @@
 #include "Game/Pilots/Pilot.hpp"
 
+const char* const Pilot::AXIS_NAMES[NUM_PILOT_AXES] = { "Up", "Right", "ShootUp", "ShootRight" };
+const char* const Pilot::ACTION_NAMES[NUM_PILOT_ACTIONS] =
+{
+    "Shoot", "Suicide", "Activate", "Warp", "Accept", "Back", "Respawn", "Pause",
+    "EjectActive", "EjectWeapon", "EjectPassive", "EjectChassis", "CycleColorsLeft", "CycleColorsRight"
+};
+
 //-----------------------------------------------------------------------------------
 Pilot::Pilot()
 {
-
+    for (int i = 0; i < NUM_PILOT_AXES; ++i)
+    {
+        m_boundAxes[i] = nullptr;
+    }
+    for (int i = 0; i < NUM_PILOT_ACTIONS; ++i)
+    {
+        m_boundActions[i] = nullptr;
+        m_latchedPresses[i] = false;
+    }
 }
 
 //-----------------------------------------------------------------------------------
@@ -12,6 +27,47 @@ Pilot::~Pilot()
     m_inputMap.Clear();
 }
 
+//-----------------------------------------------------------------------------------
+//Call once the input map is fully set up. Actions this pilot never mapped stay null and read as released.
+void Pilot::BindInputActions()
+{
+    for (int i = 0; i < NUM_PILOT_AXES; ++i)
+    {
+        m_boundAxes[i] = m_inputMap.FindInputAxis(AXIS_NAMES[i]);
+    }
+    for (int i = 0; i < NUM_PILOT_ACTIONS; ++i)
+    {
+        m_boundActions[i] = m_inputMap.FindInputValue(ACTION_NAMES[i]);
+    }
+}
+
+//Called once per rendered frame. Presses accumulate across frames that run no fixed step, and are cleared after the first step that does.
+//-----------------------------------------------------------------------------------
+void Pilot::LatchPresses()
+{
+    for (int i = 0; i < NUM_PILOT_ACTIONS; ++i)
+    {
+        m_latchedPresses[i] = m_latchedPresses[i] || WasJustPressed((PilotAction)i);
+    }
+}
+
+//-----------------------------------------------------------------------------------
+void Pilot::ClearLatchedPresses()
+{
+    for (int i = 0; i < NUM_PILOT_ACTIONS; ++i)
+    {
+        m_latchedPresses[i] = false;
+    }
+}
+
+//-----------------------------------------------------------------------------------
+Vector2 Pilot::GetVector2(PilotAxis xAxis, PilotAxis yAxis) const
+{
+    InputAxis* x = m_boundAxes[xAxis];
+    InputAxis* y = m_boundAxes[yAxis];
+    return Vector2(x ? x->GetValue() : 0.0f, y ? y->GetValue() : 0.0f);
+}
+
 //-----------------------------------------------------------------------------------
 void Pilot::RecoilScreenshake(float /*magnitude*/, const Vector2& /*direction*/)
 {
@@ -3,6 +3,35 @@
 #include "Engine\Core\ErrorWarningAssert.hpp"
 class Ship;
 
+//Actions a ship reads every frame. Bound once to the InputMap's entries so the hot path never hashes a name.
+enum PilotAxis
+{
+    UP_AXIS,
+    RIGHT_AXIS,
+    SHOOT_UP_AXIS,
+    SHOOT_RIGHT_AXIS,
+    NUM_PILOT_AXES
+};
+
+enum PilotAction
+{
+    SHOOT_ACTION,
+    SUICIDE_ACTION,
+    ACTIVATE_ACTION,
+    WARP_ACTION,
+    ACCEPT_ACTION,
+    BACK_ACTION,
+    RESPAWN_ACTION,
+    PAUSE_ACTION,
+    EJECT_ACTIVE_ACTION,
+    EJECT_WEAPON_ACTION,
+    EJECT_PASSIVE_ACTION,
+    EJECT_CHASSIS_ACTION,
+    CYCLE_COLORS_LEFT_ACTION,
+    CYCLE_COLORS_RIGHT_ACTION,
+    NUM_PILOT_ACTIONS
+};
+
 class Pilot
 {
 public:
@@ -15,7 +44,23 @@ public:
     virtual void RecoilScreenshake(float magnitude, const Vector2& direction);
     virtual void LightRumble(float amount, float secondsDuration = 0.25f);
     virtual void HeavyRumble(float amount, float secondsDuration = 0.25f);
+    void BindInputActions();
+    Vector2 GetVector2(PilotAxis xAxis, PilotAxis yAxis) const;
+    inline InputAxis* GetAxis(PilotAxis axis) const { return m_boundAxes[axis]; };
+    inline InputValue* GetAction(PilotAction action) const { return m_boundActions[action]; };
+    inline bool IsDown(PilotAction action) const { return m_boundActions[action] && m_boundActions[action]->IsDown(); };
+    inline bool WasJustPressed(PilotAction action) const { return m_boundActions[action] && m_boundActions[action]->WasJustPressed(); };
+    void LatchPresses();
+    void ClearLatchedPresses();
+    inline bool HasLatchedPress(PilotAction action) const { return m_latchedPresses[action]; };
 
     //MEMBER VARIABLES/////////////////////////////////////////////////////////////////////
-    InputMap m_inputMap;
+    InputMap m_inputMap; //Name-based setup and console access only; per-frame reads go through the bound actions.
+    InputAxis* m_boundAxes[NUM_PILOT_AXES];
+    InputValue* m_boundActions[NUM_PILOT_ACTIONS];
+    bool m_latchedPresses[NUM_PILOT_ACTIONS]; //Presses seen since the last fixed step, so each one fires exactly once in the world.
+
+    //CONSTANTS/////////////////////////////////////////////////////////////////////
+    static const char* const AXIS_NAMES[NUM_PILOT_AXES];
+    static const char* const ACTION_NAMES[NUM_PILOT_ACTIONS];
 };
\ No newline at end of file
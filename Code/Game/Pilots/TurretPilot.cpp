@@ -22,33 +22,32 @@ void TurretPilot::Update(float deltaSeconds, Ship* currentShip)
         return;
     }
 
-    m_timeSinceRetargetSeconds += deltaSeconds;
-    m_timeSinceRewanderSeconds += deltaSeconds;
-
-    if (m_timeSinceRetargetSeconds > TIME_IN_BETWEEN_TARGETING_SECONDS)
+    if (!m_director)
     {
-        FindTarget();
-        m_timeSinceRetargetSeconds = 0.0f;
+        RegisterWithDirector(m_currentShip);
     }
+
+    m_timeSinceRewanderSeconds += deltaSeconds;
     if (m_timeSinceRewanderSeconds > TIME_IN_BETWEEN_WANDERING_SECONDS)
     {
         m_wanderDirection = MathUtils::GetRandomVectorInCircle(0.75f);
         m_timeSinceRewanderSeconds = MathUtils::GetRandomFloat(0.0f, 1.0f);
     }
 
-    if (m_currentTarget)
+    Ship* target = EntityRegistry::instance->ResolveAs<Ship>(m_currentTarget);
+    if (target)
     {
-        Vector2 deltaPosition = m_currentTarget->GetPosition() - m_currentShip->GetPosition();
+        Vector2 deltaPosition = target->GetPosition() - m_currentShip->GetPosition();
         Vector2 direction = deltaPosition.GetNorm();
 
-        m_inputMap.FindInputAxis("ShootUp")->SetValue(direction.y);
-        m_inputMap.FindInputAxis("ShootRight")->SetValue(direction.x);
-        m_inputMap.FindInputValue("Shoot")->SetValue(true);
+        GetAxis(SHOOT_UP_AXIS)->SetValue(direction.y);
+        GetAxis(SHOOT_RIGHT_AXIS)->SetValue(direction.x);
+        GetAction(SHOOT_ACTION)->SetValue(true);
     }
     else
     {
-        m_inputMap.FindInputAxis("ShootRight")->SetValue(m_wanderDirection.x);
-        m_inputMap.FindInputAxis("ShootUp")->SetValue(m_wanderDirection.y);
-        m_inputMap.FindInputValue("Shoot")->SetValue(false);
+        GetAxis(SHOOT_RIGHT_AXIS)->SetValue(m_wanderDirection.x);
+        GetAxis(SHOOT_UP_AXIS)->SetValue(m_wanderDirection.y);
+        GetAction(SHOOT_ACTION)->SetValue(false);
     }
 }
\ No newline at end of file
@@ -0,0 +1,148 @@
+#include "Game/StatBlockRegistry.hpp"
+#include "Game/Entities/Ship.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define STAT_BLOCKS_USE_SSE
+#include <emmintrin.h>
+#endif
+
+StatBlockRegistry* StatBlockRegistry::instance = nullptr;
+
+//-----------------------------------------------------------------------------------
+unsigned int StatBlockRegistry::Register(Ship* ship)
+{
+    unsigned int blockIndex;
+    if (!m_freeBlocks.empty())
+    {
+        blockIndex = m_freeBlocks.back();
+        m_freeBlocks.pop_back();
+    }
+    else
+    {
+        //Grow a whole SIMD lane group at a time so the evaluation loop never needs a scalar tail.
+        blockIndex = m_owners.size();
+        unsigned int newSize = blockIndex + BLOCK_WIDTH;
+        m_owners.resize(newSize, nullptr);
+        for (int curve = 0; curve < StatCurves::NUM_STAT_CURVES; ++curve)
+        {
+            m_levels[curve].resize(newSize, Stats::MIN_LEVEL);
+            m_values[curve].resize(newSize, 0.0f);
+        }
+        for (unsigned int i = newSize - 1; i > blockIndex; --i)
+        {
+            m_freeBlocks.push_back(i);
+        }
+    }
+    m_owners[blockIndex] = ship;
+    return blockIndex;
+}
+
+//-----------------------------------------------------------------------------------
+void StatBlockRegistry::Unregister(unsigned int blockIndex)
+{
+    ASSERT_OR_DIE(blockIndex < m_owners.size() && m_owners[blockIndex], "Unregistering a stat block that isn't registered");
+    m_owners[blockIndex] = nullptr;
+    m_freeBlocks.push_back(blockIndex);
+}
+
+//Re-reads the levels of every ship whose stats were invalidated, evaluates all 12 curves for the lane groups
+//those ships sit in, then hands the fresh values back to their caches.
+//-----------------------------------------------------------------------------------
+void StatBlockRegistry::RefreshDirtyBlocks()
+{
+    m_dirtyBlocks.clear();
+    m_dirtyGroups.clear();
+    const unsigned int numBlocks = m_owners.size();
+    for (unsigned int i = 0; i < numBlocks; ++i)
+    {
+        Ship* ship = m_owners[i];
+        if (ship && ship->m_loadout->m_areStatValuesDirty)
+        {
+            GatherLevels(i);
+            m_dirtyBlocks.push_back(i);
+            unsigned int groupStart = i - (i % BLOCK_WIDTH);
+            if (m_dirtyGroups.empty() || m_dirtyGroups.back() != groupStart)
+            {
+                m_dirtyGroups.push_back(groupStart);
+            }
+        }
+    }
+    if (m_dirtyBlocks.empty())
+    {
+        return;
+    }
+
+    for (int curve = 0; curve < StatCurves::NUM_STAT_CURVES; ++curve)
+    {
+        EvaluateCurve((StatCurves::StatCurve)curve);
+    }
+
+    for (unsigned int blockIndex : m_dirtyBlocks)
+    {
+        Stats& values = m_owners[blockIndex]->m_loadout->m_statValues;
+        values.topSpeed = m_values[StatCurves::TOP_SPEED_CURVE][blockIndex];
+        values.acceleration = m_values[StatCurves::ACCELERATION_CURVE][blockIndex];
+        values.handling = m_values[StatCurves::HANDLING_CURVE][blockIndex];
+        values.braking = m_values[StatCurves::BRAKING_CURVE][blockIndex];
+        values.damage = m_values[StatCurves::DAMAGE_CURVE][blockIndex];
+        values.shieldDisruption = m_values[StatCurves::SHIELD_DISRUPTION_CURVE][blockIndex];
+        values.shotHoming = m_values[StatCurves::SHOT_HOMING_CURVE][blockIndex];
+        values.rateOfFire = m_values[StatCurves::RATE_OF_FIRE_CURVE][blockIndex];
+        values.hp = m_values[StatCurves::HP_CURVE][blockIndex];
+        values.shieldCapacity = m_values[StatCurves::SHIELD_CAPACITY_CURVE][blockIndex];
+        values.shieldRegen = m_values[StatCurves::SHIELD_REGEN_CURVE][blockIndex];
+        values.shotDeflection = m_values[StatCurves::SHOT_DEFLECTION_CURVE][blockIndex];
+        m_owners[blockIndex]->m_loadout->m_areStatValuesDirty = false;
+    }
+}
+
+//-----------------------------------------------------------------------------------
+void StatBlockRegistry::GatherLevels(unsigned int blockIndex)
+{
+    Ship* ship = m_owners[blockIndex];
+    m_levels[StatCurves::TOP_SPEED_CURVE][blockIndex] = ship->GetTopSpeedStat();
+    m_levels[StatCurves::ACCELERATION_CURVE][blockIndex] = ship->GetAccelerationStat();
+    m_levels[StatCurves::HANDLING_CURVE][blockIndex] = ship->GetHandlingStat();
+    m_levels[StatCurves::BRAKING_CURVE][blockIndex] = ship->GetBrakingStat();
+    m_levels[StatCurves::DAMAGE_CURVE][blockIndex] = ship->GetDamageStat();
+    m_levels[StatCurves::SHIELD_DISRUPTION_CURVE][blockIndex] = ship->GetShieldDisruptionStat();
+    m_levels[StatCurves::SHOT_HOMING_CURVE][blockIndex] = ship->GetShotHomingStat();
+    m_levels[StatCurves::RATE_OF_FIRE_CURVE][blockIndex] = ship->GetRateOfFireStat();
+    m_levels[StatCurves::HP_CURVE][blockIndex] = ship->GetHpStat();
+    m_levels[StatCurves::SHIELD_CAPACITY_CURVE][blockIndex] = ship->GetShieldCapacityStat();
+    m_levels[StatCurves::SHIELD_REGEN_CURVE][blockIndex] = ship->GetShieldRegenStat();
+    m_levels[StatCurves::SHOT_DEFLECTION_CURVE][blockIndex] = ship->GetShotDeflectionStat();
+}
+
+//Same math as StatCurves::Evaluate, one dirty lane group per iteration. SSE has no gather, so the table samples are loaded one lane at a time.
+//-----------------------------------------------------------------------------------
+void StatBlockRegistry::EvaluateCurve(StatCurves::StatCurve curve)
+{
+    const float* levels = m_levels[curve].data();
+    float* values = m_values[curve].data();
+
+#ifdef STAT_BLOCKS_USE_SSE
+    const float* samples = StatCurves::g_tables.m_curves[curve].m_samples;
+    const __m128 minLevel = _mm_set1_ps(Stats::MIN_LEVEL);
+    const __m128 maxLevel = _mm_set1_ps(Stats::MAX_LEVEL);
+    const __m128 samplesPerLevel = _mm_set1_ps((float)StatCurves::SAMPLES_PER_LEVEL);
+    for (unsigned int i : m_dirtyGroups)
+    {
+        __m128 level = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(levels + i), minLevel), maxLevel);
+        __m128 position = _mm_mul_ps(_mm_sub_ps(level, minLevel), samplesPerLevel);
+        __m128i index = _mm_cvttps_epi32(position);
+        __m128 fraction = _mm_sub_ps(position, _mm_cvtepi32_ps(index));
+
+        alignas(16) int indices[BLOCK_WIDTH];
+        _mm_store_si128((__m128i*)indices, index);
+        __m128 lower = _mm_setr_ps(samples[indices[0]], samples[indices[1]], samples[indices[2]], samples[indices[3]]);
+        __m128 upper = _mm_setr_ps(samples[indices[0] + 1], samples[indices[1] + 1], samples[indices[2] + 1], samples[indices[3] + 1]);
+        _mm_storeu_ps(values + i, _mm_add_ps(lower, _mm_mul_ps(_mm_sub_ps(upper, lower), fraction)));
+    }
+#else
+    for (unsigned int i : m_dirtyBlocks)
+    {
+        values[i] = StatCurves::Evaluate(curve, levels[i]);
+    }
+#endif
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include "Game/StatCurves.hpp"
+#include <vector>
+
+class Ship;
+
+//Every ship's 12 stat levels and derived values, packed stat-major so the curves can be evaluated
+//for four ships at a time. Ships whose stats changed are refreshed in one batched pass per step.
+//-----------------------------------------------------------------------------------
+class StatBlockRegistry
+{
+public:
+    //CONSTRUCTORS/////////////////////////////////////////////////////////////////////
+    StatBlockRegistry() {};
+    ~StatBlockRegistry() {};
+
+    //FUNCTIONS/////////////////////////////////////////////////////////////////////
+    unsigned int Register(Ship* ship);
+    void Unregister(unsigned int blockIndex);
+    void RefreshDirtyBlocks();
+    inline unsigned int GetNumBlocks() const { return m_owners.size(); };
+
+    //STATIC VARIABLES/////////////////////////////////////////////////////////////////////
+    static StatBlockRegistry* instance;
+    static constexpr unsigned int INVALID_INDEX = 0xFFFFFFFF;
+    static constexpr unsigned int BLOCK_WIDTH = 4;
+
+private:
+    void GatherLevels(unsigned int blockIndex);
+    void EvaluateCurve(StatCurves::StatCurve curve);
+
+    //MEMBER VARIABLES/////////////////////////////////////////////////////////////////////
+    std::vector<float> m_levels[StatCurves::NUM_STAT_CURVES];
+    std::vector<float> m_values[StatCurves::NUM_STAT_CURVES];
+    std::vector<Ship*> m_owners;
+    std::vector<unsigned int> m_freeBlocks;
+    std::vector<unsigned int> m_dirtyBlocks;
+    std::vector<unsigned int> m_dirtyGroups; //First block index of each lane group holding a dirty block.
+};
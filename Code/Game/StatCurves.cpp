@@ -0,0 +1,114 @@
+#include "Game/StatCurves.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Time/Time.hpp"
+#include <vector>
+#include <cmath>
+
+namespace
+{
+    struct CurveDefinition
+    {
+        StatCurves::CurveShape m_shape;
+        float m_minValue;
+        float m_maxValue;
+        const char* m_name;
+    };
+
+    //In StatCurve order.
+    constexpr CurveDefinition CURVE_DEFINITIONS[] =
+    {
+        { StatCurves::SMOOTH_STEP, Stats::MIN_SPEED_VALUE, Stats::MAX_SPEED_VALUE, "Top Speed" },
+        { StatCurves::SMOOTH_STOP_2, Stats::MIN_ACCELERATION_VALUE, Stats::MAX_ACCELERATION_VALUE, "Acceleration" },
+        { StatCurves::SMOOTH_STOP_2, Stats::MIN_HANDLING_VALUE, Stats::MAX_HANDLING_VALUE, "Handling" },
+        { StatCurves::SMOOTH_STOP_2, Stats::MIN_BRAKING_VALUE, Stats::MAX_BRAKING_VALUE, "Braking" },
+        { StatCurves::SMOOTH_STOP_2, Stats::MIN_DAMAGE_VALUE, Stats::MAX_DAMAGE_VALUE, "Damage" },
+        { StatCurves::SMOOTH_STOP_2, Stats::MIN_DISRUPTION_PERCENTAGE, Stats::MAX_DISRUPTION_PERCENTAGE, "Shield Disruption" },
+        { StatCurves::SMOOTH_STOP_2, Stats::MIN_SHOT_HOMING_VALUE, Stats::MAX_SHOT_HOMING_VALUE, "Shot Homing" },
+        { StatCurves::SMOOTH_STOP_2, Stats::MIN_RATE_OF_FIRE, Stats::MAX_RATE_OF_FIRE, "Rate of Fire" },
+        { StatCurves::SMOOTH_STEP, Stats::MIN_HP_VALUE, Stats::MAX_HP_VALUE, "HP" },
+        { StatCurves::SMOOTH_STEP, Stats::MIN_CAPACITY_VALUE, Stats::MAX_CAPACITY_VALUE, "Shield Capacity" },
+        { StatCurves::SMOOTH_STOP_2, Stats::MIN_REGEN_RATE, Stats::MAX_REGEN_RATE, "Shield Regen" },
+        { StatCurves::SMOOTH_STOP_2, Stats::MIN_DEFLECTION_VALUE, Stats::MAX_DEFLECTION_VALUE, "Shot Deflection" },
+    };
+    static_assert(sizeof(CURVE_DEFINITIONS) / sizeof(CURVE_DEFINITIONS[0]) == StatCurves::NUM_STAT_CURVES, "Every stat curve needs exactly one definition");
+
+    //-----------------------------------------------------------------------------------
+    template <int... Curves>
+    constexpr StatCurves::TableSet BuildTableSet(std::integer_sequence<int, Curves...>)
+    {
+        return StatCurves::TableSet{ { StatCurves::BuildTable(CURVE_DEFINITIONS[Curves].m_shape, CURVE_DEFINITIONS[Curves].m_minValue, CURVE_DEFINITIONS[Curves].m_maxValue)... } };
+    }
+
+    //Written by the benchmark so the optimizer can't throw the loops away.
+    volatile float s_benchmarkSink = 0.0f;
+}
+
+//Every table is generated from its CURVE_DEFINITIONS entry, so the definitions are the only list of curves.
+constexpr StatCurves::TableSet StatCurves::g_tables = BuildTableSet(std::make_integer_sequence<int, StatCurves::NUM_STAT_CURVES>());
+
+static_assert(StatCurves::g_tables.m_curves[StatCurves::HP_CURVE].m_samples[0] == Stats::MIN_HP_VALUE, "Stat curve tables weren't built at compile time");
+static_assert(StatCurves::g_tables.m_curves[StatCurves::HP_CURVE].m_samples[StatCurves::NUM_SAMPLES - 1] == Stats::MAX_HP_VALUE, "Stat curve table doesn't end at the max value");
+
+//The math the tables replaced: RangeMap the level to 0-1, shape it, RangeMap out to the value range.
+//-----------------------------------------------------------------------------------
+float StatCurves::EvaluateWithoutTable(StatCurve curve, float level)
+{
+    const CurveDefinition& definition = CURVE_DEFINITIONS[curve];
+    float clampedLevel = MathUtils::Clamp(level, Stats::MIN_LEVEL, Stats::MAX_LEVEL);
+    float levelZeroToOne = MathUtils::RangeMap(clampedLevel, Stats::MIN_LEVEL, Stats::MAX_LEVEL, 0.0f, 1.0f);
+    levelZeroToOne = (definition.m_shape == SMOOTH_STEP) ? MathUtils::SmoothStep(levelZeroToOne) : MathUtils::SmoothStop2(levelZeroToOne);
+    return MathUtils::RangeMap(levelZeroToOne, 0.0f, 1.0f, definition.m_minValue, definition.m_maxValue);
+}
+
+//-----------------------------------------------------------------------------------
+void StatCurves::RunBenchmark()
+{
+    static const unsigned int NUM_LEVELS = 100000;
+
+    std::vector<float> levels;
+    levels.reserve(NUM_LEVELS);
+    for (unsigned int i = 0; i < NUM_LEVELS; ++i)
+    {
+        levels.push_back(MathUtils::GetRandomFloat(Stats::MIN_LEVEL - 2.0f, Stats::MAX_LEVEL + 2.0f));
+    }
+
+    DebuggerPrintf("Stat curve benchmark, %u random levels per stat\n", NUM_LEVELS);
+    for (int curveIndex = 0; curveIndex < NUM_STAT_CURVES; ++curveIndex)
+    {
+        StatCurve curve = (StatCurve)curveIndex;
+        double directStart = GetCurrentTimeSeconds();
+        float directSum = 0.0f;
+        for (float level : levels)
+        {
+            directSum += EvaluateWithoutTable(curve, level);
+        }
+        s_benchmarkSink = directSum;
+        double directSeconds = GetCurrentTimeSeconds() - directStart;
+
+        double tableStart = GetCurrentTimeSeconds();
+        float tableSum = 0.0f;
+        for (float level : levels)
+        {
+            tableSum += Evaluate(curve, level);
+        }
+        s_benchmarkSink = tableSum;
+        double tableSeconds = GetCurrentTimeSeconds() - tableStart;
+
+        float maxError = 0.0f;
+        float maxIntegerLevelError = 0.0f;
+        for (float level : levels)
+        {
+            maxError = std::max<float>(maxError, fabs(Evaluate(curve, level) - EvaluateWithoutTable(curve, level)));
+        }
+        for (float level = Stats::MIN_LEVEL; level <= Stats::MAX_LEVEL; level += 1.0f)
+        {
+            maxIntegerLevelError = std::max<float>(maxIntegerLevelError, fabs(Evaluate(curve, level) - EvaluateWithoutTable(curve, level)));
+        }
+
+        float range = fabs(CURVE_DEFINITIONS[curve].m_maxValue - CURVE_DEFINITIONS[curve].m_minValue);
+        ASSERT_OR_DIE(maxIntegerLevelError <= range * 0.0001f, "Stat curve table disagrees with the curve at a whole level");
+        DebuggerPrintf("%-18s direct %.3fms | table %.3fms | max error %f (%.4f%% of range)\n",
+            CURVE_DEFINITIONS[curve].m_name, directSeconds * 1000.0, tableSeconds * 1000.0, maxError, range > 0.0f ? (maxError / range) * 100.0f : 0.0f);
+    }
+}
@@ -0,0 +1,89 @@
+#pragma once
+#include "Game/Stats.hpp"
+#include <utility>
+#include <algorithm>
+
+//Lookup tables for the stat level -> gameplay value curves, built at compile time.
+//Levels are sampled SAMPLES_PER_LEVEL times per level and linearly interpolated in between.
+//-----------------------------------------------------------------------------------
+namespace StatCurves
+{
+    //ENUMS/////////////////////////////////////////////////////////////////////
+    enum StatCurve
+    {
+        TOP_SPEED_CURVE = 0,
+        ACCELERATION_CURVE,
+        HANDLING_CURVE,
+        BRAKING_CURVE,
+        DAMAGE_CURVE,
+        SHIELD_DISRUPTION_CURVE,
+        SHOT_HOMING_CURVE,
+        RATE_OF_FIRE_CURVE,
+        HP_CURVE,
+        SHIELD_CAPACITY_CURVE,
+        SHIELD_REGEN_CURVE,
+        SHOT_DEFLECTION_CURVE,
+        NUM_STAT_CURVES
+    };
+
+    enum CurveShape
+    {
+        SMOOTH_STEP,
+        SMOOTH_STOP_2
+    };
+
+    //CONSTANTS/////////////////////////////////////////////////////////////////////
+    static constexpr int SAMPLES_PER_LEVEL = 4;
+    //One past the last level so the upper neighbour of any clamped level is always in the table.
+    static constexpr int NUM_SAMPLES = (int)((Stats::MAX_LEVEL - Stats::MIN_LEVEL) * SAMPLES_PER_LEVEL) + 2;
+
+    //STRUCTS/////////////////////////////////////////////////////////////////////
+    struct Table
+    {
+        float m_samples[NUM_SAMPLES];
+    };
+
+    struct TableSet
+    {
+        Table m_curves[NUM_STAT_CURVES];
+    };
+
+    //TABLE GENERATION/////////////////////////////////////////////////////////////////////
+    //Single-expression constexpr functions so they still evaluate at compile time on v140.
+    constexpr float ClampZeroToOne(float t) { return t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t); };
+    constexpr float SmoothStep(float t) { return t * t * (3.0f - (2.0f * t)); };
+    constexpr float SmoothStop2(float t) { return 1.0f - ((1.0f - t) * (1.0f - t)); };
+    constexpr float ApplyShape(CurveShape shape, float t) { return shape == SMOOTH_STEP ? SmoothStep(t) : SmoothStop2(t); };
+
+    constexpr float CalculateSample(CurveShape shape, float minValue, float maxValue, int sampleIndex)
+    {
+        return minValue + ((maxValue - minValue) * ApplyShape(shape, ClampZeroToOne(((float)sampleIndex / (float)SAMPLES_PER_LEVEL) / (Stats::MAX_LEVEL - Stats::MIN_LEVEL))));
+    };
+
+    template <int... SampleIndices>
+    constexpr Table BuildTable(CurveShape shape, float minValue, float maxValue, std::integer_sequence<int, SampleIndices...>)
+    {
+        return Table{ { CalculateSample(shape, minValue, maxValue, SampleIndices)... } };
+    };
+
+    constexpr Table BuildTable(CurveShape shape, float minValue, float maxValue)
+    {
+        return BuildTable(shape, minValue, maxValue, std::make_integer_sequence<int, NUM_SAMPLES>());
+    };
+
+    //FUNCTIONS/////////////////////////////////////////////////////////////////////
+    extern const TableSet g_tables;
+
+    //Level is clamped to [MIN_LEVEL, MAX_LEVEL]. No branches, just a clamp, two loads and a lerp.
+    inline float Evaluate(StatCurve curve, float level)
+    {
+        float position = (std::min(std::max(level, Stats::MIN_LEVEL), Stats::MAX_LEVEL) - Stats::MIN_LEVEL) * (float)SAMPLES_PER_LEVEL;
+        int index = (int)position;
+        float fraction = position - (float)index;
+        const float* samples = g_tables.m_curves[curve].m_samples;
+        return samples[index] + ((samples[index + 1] - samples[index]) * fraction);
+    };
+
+    float EvaluateWithoutTable(StatCurve curve, float level);
+    void RunBenchmark();
+}
@@ -2,38 +2,38 @@
 #include "Game/Items/PowerUp.hpp"
 #include "Engine/Core/ErrorWarningAssert.hpp"
 
-const float Stats::MIN_LEVEL = 1.0f;
-const float Stats::MAX_LEVEL = 36.0f;
+constexpr float Stats::MIN_LEVEL;
+constexpr float Stats::MAX_LEVEL;
 
 //SPEED/////////////////////////////////////////////////////////////////////
-const float Stats::MIN_SPEED_VALUE = 3.0f;
-const float Stats::MAX_SPEED_VALUE = 20.0f;
-const float Stats::MIN_ACCELERATION_VALUE = 0.05f;
-const float Stats::MAX_ACCELERATION_VALUE = 0.9f;
-const float Stats::MIN_HANDLING_VALUE = 0.05f;
-const float Stats::MAX_HANDLING_VALUE = 0.9f;
-const float Stats::MIN_BRAKING_VALUE = 0.97f;
-const float Stats::MAX_BRAKING_VALUE = 0.95f;
+constexpr float Stats::MIN_SPEED_VALUE;
+constexpr float Stats::MAX_SPEED_VALUE;
+constexpr float Stats::MIN_ACCELERATION_VALUE;
+constexpr float Stats::MAX_ACCELERATION_VALUE;
+constexpr float Stats::MIN_HANDLING_VALUE;
+constexpr float Stats::MAX_HANDLING_VALUE;
+constexpr float Stats::MIN_BRAKING_VALUE;
+constexpr float Stats::MAX_BRAKING_VALUE;
 
 //POWER/////////////////////////////////////////////////////////////////////
-const float Stats::MIN_DAMAGE_VALUE = 10.0f;
-const float Stats::MAX_DAMAGE_VALUE = 50.0f;
-const float Stats::MIN_DISRUPTION_PERCENTAGE = 0.0f;
-const float Stats::MAX_DISRUPTION_PERCENTAGE = 0.5f;
-const float Stats::MIN_SHOT_HOMING_VALUE = 0.0f;
-const float Stats::MAX_SHOT_HOMING_VALUE = 30.0f;
-const float Stats::MIN_RATE_OF_FIRE = 3.0f; //Shots per second
-const float Stats::MAX_RATE_OF_FIRE = 10.0f;
+constexpr float Stats::MIN_DAMAGE_VALUE;
+constexpr float Stats::MAX_DAMAGE_VALUE;
+constexpr float Stats::MIN_DISRUPTION_PERCENTAGE;
+constexpr float Stats::MAX_DISRUPTION_PERCENTAGE;
+constexpr float Stats::MIN_SHOT_HOMING_VALUE;
+constexpr float Stats::MAX_SHOT_HOMING_VALUE;
+constexpr float Stats::MIN_RATE_OF_FIRE;
+constexpr float Stats::MAX_RATE_OF_FIRE;
 
 //DEFENSE/////////////////////////////////////////////////////////////////////
-const float Stats::MIN_HP_VALUE = 100.0f;
-const float Stats::MAX_HP_VALUE = 1000.0f;
-const float Stats::MIN_CAPACITY_VALUE = 30.0f;
-const float Stats::MAX_CAPACITY_VALUE = 200.0f;
-const float Stats::MIN_REGEN_RATE = 10.0f; //Points per second
-const float Stats::MAX_REGEN_RATE = 50.0f;
-const float Stats::MIN_DEFLECTION_VALUE = 0.0f;
-const float Stats::MAX_DEFLECTION_VALUE = 30.0f;
+constexpr float Stats::MIN_HP_VALUE;
+constexpr float Stats::MAX_HP_VALUE;
+constexpr float Stats::MIN_CAPACITY_VALUE;
+constexpr float Stats::MAX_CAPACITY_VALUE;
+constexpr float Stats::MIN_REGEN_RATE;
+constexpr float Stats::MAX_REGEN_RATE;
+constexpr float Stats::MIN_DEFLECTION_VALUE;
+constexpr float Stats::MAX_DEFLECTION_VALUE;
 
 //-----------------------------------------------------------------------------------
 Stats::Stats(float defaultValue)
@@ -24,35 +24,35 @@ struct Stats
     float shotDeflection;
 
     //STATIC VARIABLES/////////////////////////////////////////////////////////////////////
-    static const float MIN_LEVEL;
-    static const float MAX_LEVEL;
+    static constexpr float MIN_LEVEL = 1.0f;
+    static constexpr float MAX_LEVEL = 36.0f;
 
     //Minimum Stat Values
-    static const float MIN_SPEED_VALUE;
-    static const float MIN_ACCELERATION_VALUE;
-    static const float MIN_HANDLING_VALUE;
-    static const float MIN_BRAKING_VALUE;
-    static const float MIN_DAMAGE_VALUE;
-    static const float MIN_DISRUPTION_PERCENTAGE;
-    static const float MIN_SHOT_HOMING_VALUE;
-    static const float MIN_RATE_OF_FIRE;
-    static const float MIN_HP_VALUE;
-    static const float MIN_CAPACITY_VALUE;
-    static const float MIN_REGEN_RATE;
-    static const float MIN_DEFLECTION_VALUE;
+    static constexpr float MIN_SPEED_VALUE = 3.0f;
+    static constexpr float MIN_ACCELERATION_VALUE = 0.05f;
+    static constexpr float MIN_HANDLING_VALUE = 0.05f;
+    static constexpr float MIN_BRAKING_VALUE = 0.97f;
+    static constexpr float MIN_DAMAGE_VALUE = 10.0f;
+    static constexpr float MIN_DISRUPTION_PERCENTAGE = 0.0f;
+    static constexpr float MIN_SHOT_HOMING_VALUE = 0.0f;
+    static constexpr float MIN_RATE_OF_FIRE = 3.0f; //Shots per second
+    static constexpr float MIN_HP_VALUE = 100.0f;
+    static constexpr float MIN_CAPACITY_VALUE = 30.0f;
+    static constexpr float MIN_REGEN_RATE = 10.0f; //Points per second
+    static constexpr float MIN_DEFLECTION_VALUE = 0.0f;
 
     //Maximum Stat Values
-    static const float MAX_SPEED_VALUE;
-    static const float MAX_ACCELERATION_VALUE;
-    static const float MAX_HANDLING_VALUE;
-    static const float MAX_BRAKING_VALUE;
-    static const float MAX_DAMAGE_VALUE;
-    static const float MAX_DISRUPTION_PERCENTAGE;
-    static const float MAX_SHOT_HOMING_VALUE;
-    static const float MAX_RATE_OF_FIRE;
-    static const float MAX_HP_VALUE;
-    static const float MAX_CAPACITY_VALUE;
-    static const float MAX_REGEN_RATE;
-    static const float MAX_DEFLECTION_VALUE;
+    static constexpr float MAX_SPEED_VALUE = 20.0f;
+    static constexpr float MAX_ACCELERATION_VALUE = 0.9f;
+    static constexpr float MAX_HANDLING_VALUE = 0.9f;
+    static constexpr float MAX_BRAKING_VALUE = 0.95f;
+    static constexpr float MAX_DAMAGE_VALUE = 50.0f;
+    static constexpr float MAX_DISRUPTION_PERCENTAGE = 0.5f;
+    static constexpr float MAX_SHOT_HOMING_VALUE = 30.0f;
+    static constexpr float MAX_RATE_OF_FIRE = 10.0f;
+    static constexpr float MAX_HP_VALUE = 1000.0f;
+    static constexpr float MAX_CAPACITY_VALUE = 200.0f;
+    static constexpr float MAX_REGEN_RATE = 50.0f;
+    static constexpr float MAX_DEFLECTION_VALUE = 30.0f;
 
 };
\ No newline at end of file
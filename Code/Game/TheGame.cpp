@@ -36,6 +36,7 @@
 #include "Game/GameCommon.hpp"
 #include "Engine/UI/UISystem.hpp"
 #include "Game/Entities/TextSplash.hpp"
+#include "Game/Entities/DamageNumbers.hpp"
 #include "Game/GameModes/Minigames/DeathBattleMinigameMode.hpp"
 #include "Game/GameModes/InstancedGameMode.hpp"
 #include "Engine/Math/MathUtils.hpp"
@@ -51,6 +52,11 @@
 #include "Pilots/BasicEnemyPilot.hpp"
 #include "GameModes/Minigames/DrainMinigameMode.hpp"
 #include "GameModes/Minigames/GladiatorMinigameMode.hpp"
+#include "Game/WorkerPool.hpp"
+#include "Game/StatCurves.hpp"
+#include "Game/ObjectPool.hpp"
+#include "Game/LinearArena.hpp"
+#include "Game/StatBlockRegistry.hpp"
 
 TheGame* TheGame::instance = nullptr;
 
@@ -72,6 +78,9 @@ TheGame::TheGame()
 {
     srand(GetTimeBasedSeed());
     ResourceDatabase::instance = new ResourceDatabase();
+    WorkerPool::instance = new WorkerPool(WorkerPool::CalculateDefaultNumWorkers());
+    StatBlockRegistry::instance = new StatBlockRegistry();
+    EntityRegistry::instance = new EntityRegistry();
     RegisterSprites();
     RegisterSpriteAnimations();
     RegisterParticleEffects();
@@ -132,6 +141,7 @@ TheGame::~TheGame()
 {
     SetGameState(GameState::SHUTDOWN);
     TextSplash::Cleanup();
+    DamageNumbers::Cleanup();
     FlushRunAfterSecondsFunctions();
 
     SpriteGameRenderer::instance->RemoveEffectFromLayer(m_transitionFBOEffect, FULL_SCREEN_EFFECT_LAYER);
@@ -150,6 +160,7 @@ TheGame::~TheGame()
     {
         m_currentGameMode->CleanUp();
         delete m_currentGameMode;
+        m_currentGameMode = nullptr;
     }
 
     unsigned int numModes = m_queuedMinigameModes.size();
@@ -163,6 +174,13 @@ TheGame::~TheGame()
 
     delete ResourceDatabase::instance;
     ResourceDatabase::instance = nullptr;
+    delete WorkerPool::instance;
+    WorkerPool::instance = nullptr;
+    delete StatBlockRegistry::instance;
+    StatBlockRegistry::instance = nullptr;
+    delete EntityRegistry::instance;
+    EntityRegistry::instance = nullptr;
+    LinearArena::ClearPageCache();
 }
 
 //-----------------------------------------------------------------------------------
@@ -193,6 +211,7 @@ void TheGame::Update(float deltaSeconds)
     {
         m_fpsCounter->SetProperty<std::string>("Text", Stringf("%02.02f", 1.0f / (ProfilingSystem::instance->GetAverageFrameDuration())));
     }
+    ObjectPoolBase::ReportToProfiler();
 #endif
 
     g_secondsInState += deltaSeconds;
@@ -205,6 +224,11 @@ void TheGame::Update(float deltaSeconds)
             Console::instance->RunCommand("printprofiling");
             Console::instance->ToggleConsole();
         }
+        if (InputSystem::instance->WasKeyJustPressed('B'))
+        {
+            CollisionGrid::RunBenchmark();
+            StatCurves::RunBenchmark();
+        }
         if (InputSystem::instance->WasKeyJustPressed(InputSystem::ExtraKeys::TILDE))
         {
             Console::instance->ToggleConsole();
@@ -256,6 +280,7 @@ void TheGame::Update(float deltaSeconds)
     }
     ProfilingSystem::instance->PushSample("TextSplash Update");
     TextSplash::Update(deltaSeconds);
+    DamageNumbers::Update(deltaSeconds);
     ProfilingSystem::instance->PopSample("TextSplash Update");
 
     ProfilingSystem::instance->PushSample("SGR Update");
@@ -634,19 +659,19 @@ void TheGame::UpdatePlayerJoin(float)
     {
         PlayerPilot* pilot = m_playerPilots[i];
 
-        if(pilot->m_inputMap.WasJustPressed("Accept") && (m_numberOfReadyPlayers < m_numberOfPlayers) && m_readyText[i]->m_text == PRESS_START_TO_READY_STRING)
+        if(pilot->WasJustPressed(ACCEPT_ACTION) && (m_numberOfReadyPlayers < m_numberOfPlayers) && m_readyText[i]->m_text == PRESS_START_TO_READY_STRING)
         {
             ++m_numberOfReadyPlayers;
             m_readyText[i]->m_text = READY_STRING;
             m_readyText[i]->m_color = RGBA::GREEN;
         }
-        else if (pilot->m_inputMap.WasJustPressed("Back") && (m_numberOfReadyPlayers > 0) && m_readyText[i]->m_text == READY_STRING)
+        else if (pilot->WasJustPressed(BACK_ACTION) && (m_numberOfReadyPlayers > 0) && m_readyText[i]->m_text == READY_STRING)
         {
             --m_numberOfReadyPlayers;
             m_readyText[i]->m_text = PRESS_START_TO_READY_STRING;
             m_readyText[i]->m_color = RGBA::CORNFLOWER_BLUE;
         }
-        else if (((pilot->m_inputMap.WasJustPressed("Accept")) && (m_numberOfReadyPlayers == m_numberOfPlayers)) || (m_numberOfPlayers == 4 && InputSystem::instance->WasKeyJustPressed(InputSystem::ExtraKeys::F9)))
+        else if (((pilot->WasJustPressed(ACCEPT_ACTION)) && (m_numberOfReadyPlayers == m_numberOfPlayers)) || (m_numberOfPlayers == 4 && InputSystem::instance->WasKeyJustPressed(InputSystem::ExtraKeys::F9)))
         {
             RunAfterSeconds([]()
             {
@@ -661,7 +686,7 @@ void TheGame::UpdatePlayerJoin(float)
             AudioSystem::instance->PlaySound(SFX_UI_ADVANCE);
             return;
         }
-        else if (pilot->m_inputMap.WasJustPressed("CycleColorsLeft") && m_readyText[i]->m_text != READY_STRING)
+        else if (pilot->WasJustPressed(CYCLE_COLORS_LEFT_ACTION) && m_readyText[i]->m_text != READY_STRING)
         {
             m_paletteOffsets[i] = Mod((m_paletteOffsets[i] - 1), 16);
             float paletteIndex = static_cast<float>(m_paletteOffsets[i]) / 16.0f;
@@ -672,7 +697,7 @@ void TheGame::UpdatePlayerJoin(float)
             m_leftArrows[i]->m_material->SetFloatUniform(paletteOffsetUniform, leftPaletteIndex);
             m_rightArrows[i]->m_material->SetFloatUniform(paletteOffsetUniform, rightPaletteIndex);
         }
-        else if (pilot->m_inputMap.WasJustPressed("CycleColorsRight") && m_readyText[i]->m_text != READY_STRING)
+        else if (pilot->WasJustPressed(CYCLE_COLORS_RIGHT_ACTION) && m_readyText[i]->m_text != READY_STRING)
         {
             m_paletteOffsets[i] = Mod((m_paletteOffsets[i] + 1), 16);
             float paletteIndex = static_cast<float>(m_paletteOffsets[i]) / 16.0f;
@@ -686,7 +711,7 @@ void TheGame::UpdatePlayerJoin(float)
 
         static const float DEADZONE_BEFORE_ROTATION = 0.3f;
         static const float DEADZONE_BEFORE_ROTATION_SQUARED = DEADZONE_BEFORE_ROTATION * DEADZONE_BEFORE_ROTATION;
-        Vector2 shootDirection = pilot->m_inputMap.GetVector2("ShootRight", "ShootUp");
+        Vector2 shootDirection = pilot->GetVector2(SHOOT_RIGHT_AXIS, SHOOT_UP_AXIS);
         if (shootDirection.CalculateMagnitudeSquared() > DEADZONE_BEFORE_ROTATION_SQUARED)
         {
             m_shipPreviews[i]->m_transform.SetRotationDegrees(shootDirection.GetDirectionDegrees());
@@ -822,7 +847,7 @@ void TheGame::UpdateAssemblyGetReady(float deltaSeconds)
     }
     for (PlayerPilot* pilot : m_playerPilots)
     {
-        if (pilot->m_inputMap.WasJustPressed("Accept") || InputSystem::instance->WasKeyJustPressed(InputSystem::ExtraKeys::F9))
+        if (pilot->WasJustPressed(ACCEPT_ACTION) || InputSystem::instance->WasKeyJustPressed(InputSystem::ExtraKeys::F9))
         {
             RunAfterSeconds([]()
             {
@@ -974,7 +999,7 @@ void TheGame::InitializeAssemblyResultsState()
     {
         PlayerShip* ship = TheGame::instance->m_players[i];
         ship->Respawn();
-        ship->m_shieldSprite->Disable();
+        ship->m_loadout->m_shieldSprite->Disable();
         ship->SetPosition(Vector2(5.0f, 0.0f));
         ship->m_sprite->m_transform.SetScale(Vector2(SHIP_SCALE));
         ship->m_sprite->m_viewableBy = (uchar)SpriteGameRenderer::GetVisibilityFilterForPlayerNumber(i);
@@ -997,7 +1022,7 @@ void TheGame::CleanupAssemblyResultsState(unsigned int)
     {
         ship->m_isDead = false;
         ship->Respawn();
-        ship->m_shieldSprite->Enable();
+        ship->m_loadout->m_shieldSprite->Enable();
         ship->m_sprite->m_transform.SetScale(Vector2(1.0f));
         ship->m_sprite->m_viewableBy = (uchar)SpriteGameRenderer::PlayerVisibility::ALL;
         ship->m_shipTrail->Enable();
@@ -1020,7 +1045,9 @@ void TheGame::UpdateAssemblyResults(float deltaSeconds)
 {
     for (PlayerShip* ship : TheGame::instance->m_players)
     {
+        ship->m_pilot->LatchPresses(); //Outside the fixed step there's exactly one update per frame.
         ship->Update(deltaSeconds);
+        ship->m_pilot->ClearLatchedPresses();
     }
     if (g_secondsInState < TIME_BEFORE_PLAYERS_CAN_ADVANCE_UI)
     {
@@ -1094,7 +1121,7 @@ void TheGame::UpdateMinigameGetReady(float deltaSeconds)
     }
     for (PlayerPilot* pilot : m_playerPilots)
     {
-        if (pilot->m_inputMap.WasJustPressed("Accept") || InputSystem::instance->WasKeyJustPressed(InputSystem::ExtraKeys::F9))
+        if (pilot->WasJustPressed(ACCEPT_ACTION) || InputSystem::instance->WasKeyJustPressed(InputSystem::ExtraKeys::F9))
         {
             RunAfterSeconds([]()
             {
@@ -1136,7 +1163,7 @@ void TheGame::InitializeMinigamePlayingState()
         for (PlayerShip* ship : m_players)
         {
             ship->m_sprite->Disable();
-            ship->m_shieldSprite->Disable();
+            ship->m_loadout->m_shieldSprite->Disable();
             ship->m_shipTrail->Disable();
         }
 
@@ -1144,7 +1171,7 @@ void TheGame::InitializeMinigamePlayingState()
         for (PlayerShip* ship : players)
         {
             ship->m_sprite->Enable();
-            ship->m_shieldSprite->Enable();
+            ship->m_loadout->m_shieldSprite->Enable();
             ship->m_shipTrail->Enable();
         }
         m_currentGameMode->Initialize(players);
@@ -1232,7 +1259,7 @@ void TheGame::InitializeMinigameResultsState()
     for (PlayerShip* ship : m_players)
     {
         ship->m_sprite->Enable();
-        ship->m_shieldSprite->Enable();
+        ship->m_loadout->m_shieldSprite->Enable();
         ship->m_shipTrail->Enable();
     }
 
@@ -1253,7 +1280,7 @@ void TheGame::InitializeMinigameResultsState()
     {
         PlayerShip* ship = TheGame::instance->m_players[i];
         ship->Respawn();
-        ship->m_shieldSprite->Disable();
+        ship->m_loadout->m_shieldSprite->Disable();
         ship->m_sprite->m_transform.SetScale(Vector2(SHIP_SCALE));
         ship->LockMovement();
         float xMultiplier = i % 2 == 0 ? -1.0f : 1.0f;
@@ -1321,7 +1348,7 @@ void TheGame::CleanupMinigameResultsState(unsigned int)
         ship->UnlockMovement();
         ship->m_isDead = false;
         ship->m_sprite->m_transform.SetScale(Vector2::ONE);
-        ship->m_shieldSprite->Enable();
+        ship->m_loadout->m_shieldSprite->Enable();
         delete m_rankText[i];
         delete m_scoreEarnedText[i];
         delete m_totalScoreText[i];
@@ -1354,7 +1381,9 @@ void TheGame::UpdateMinigameResults(float deltaSeconds)
     for (PlayerShip* ship : TheGame::instance->m_players)
     {
         ship->m_warpFreebieActive.m_energy = 1.0f; //Free Warping!!! <3
+        ship->m_pilot->LatchPresses(); //Outside the fixed step there's exactly one update per frame.
         ship->Update(deltaSeconds);
+        ship->m_pilot->ClearLatchedPresses();
     }
 
     if (g_secondsInState < TIME_BEFORE_PLAYERS_CAN_ADVANCE_UI)
@@ -1442,7 +1471,7 @@ void TheGame::InitializeGameOverState()
     {
         PlayerShip* ship = TheGame::instance->m_players[i];
         ship->Respawn();
-        ship->m_shieldSprite->Disable();
+        ship->m_loadout->m_shieldSprite->Disable();
         ship->LockMovement();
         ship->LockAbilities();
         float x = (widthSubsection * i) - (width / 2.0f);
@@ -1514,7 +1543,9 @@ void TheGame::UpdateGameOver(float deltaSeconds)
 {
     for (PlayerShip* ship : TheGame::instance->m_players)
     {
+        ship->m_pilot->LatchPresses(); //Outside the fixed step there's exactly one update per frame.
         ship->Update(deltaSeconds);
+        ship->m_pilot->ClearLatchedPresses();
     }
 
     if (g_secondsInState > GAME_OVER_ANIMATION_LENGTH_SECONDS + 2.0f)
@@ -1568,8 +1599,7 @@ void TheGame::RenderDebug() const
             {
                 SpriteGameRenderer::instance->DrawPolygonOutline(ent->m_transform.GetWorldPosition(), ent->m_collisionRadius, 20, 0);
 
-                Ship* ship = dynamic_cast<Ship*>(ent);
-                if (ship)
+                if (ent->IsShip())
                 {
                     SpriteGameRenderer::instance->DrawPolygonOutline(ent->m_transform.GetWorldPosition(), sqrt(BasicEnemyPilot::DETECTION_RADIUS_SQUARED * (Ship::MAX_STEALTH_FACTOR - m_players[0]->m_stealthFactor)), 20, 0, RGBA::CERULEAN);
                 }
@@ -1640,7 +1670,7 @@ void TheGame::CheckForGamePaused()
 {
     for (PlayerShip* ship : m_players)
     {
-        if (!ship->m_isDead && ship->m_pilot->m_inputMap.FindInputValue("Pause")->WasJustPressed() || (g_isGamePaused && ship->m_pilot->m_inputMap.FindInputValue("Back")->WasJustPressed()))
+        if (!ship->m_isDead && ship->m_pilot->WasJustPressed(PAUSE_ACTION) || (g_isGamePaused && ship->m_pilot->WasJustPressed(BACK_ACTION)))
         {
             g_isGamePaused = !g_isGamePaused;
             if (g_isGamePaused)
@@ -1755,6 +1785,7 @@ void TheGame::InitializeKeyMappingsForPlayer(PlayerPilot* playerPilot)
         playerPilot->m_inputMap.MapInputValue("CycleColorsLeft", &controller->GetInvertedLeftStick()->m_xAxis);
         playerPilot->m_inputMap.MapInputValue("CycleColorsRight", &controller->GetLeftStick()->m_xAxis);
     }
+    playerPilot->BindInputActions();
 }
 
 //-----------------------------------------------------------------------------------
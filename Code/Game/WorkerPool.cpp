@@ -0,0 +1,99 @@
+#include "Game/WorkerPool.hpp"
+#include <algorithm>
+
+WorkerPool* WorkerPool::instance = nullptr;
+
+//-----------------------------------------------------------------------------------
+WorkerPool::WorkerPool(unsigned int numWorkers)
+    : m_nextChunk(0)
+{
+    for (unsigned int i = 0; i < numWorkers; ++i)
+    {
+        m_workers.emplace_back(&WorkerPool::WorkerMain, this);
+    }
+}
+
+//-----------------------------------------------------------------------------------
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isShuttingDown = true;
+    }
+    m_wakeCondition.notify_all();
+    for (std::thread& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+//-----------------------------------------------------------------------------------
+unsigned int WorkerPool::CalculateDefaultNumWorkers()
+{
+    //Leave a core for the main thread, which also picks up chunks while it waits.
+    unsigned int numCores = std::thread::hardware_concurrency();
+    return numCores > 1 ? std::min<unsigned int>(numCores - 1, 7) : 0;
+}
+
+//-----------------------------------------------------------------------------------
+void WorkerPool::ParallelFor(unsigned int numChunks, const std::function<void(unsigned int chunkIndex)>& job)
+{
+    if (m_workers.empty() || numChunks <= 1)
+    {
+        for (unsigned int i = 0; i < numChunks; ++i)
+        {
+            job(i);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_job = &job;
+        m_numChunks = numChunks;
+        m_nextChunk = 0;
+        m_numBusyWorkers = m_workers.size();
+        ++m_generation;
+    }
+    m_wakeCondition.notify_all();
+    RunChunks();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_doneCondition.wait(lock, [&]() { return m_numBusyWorkers == 0; });
+    m_job = nullptr;
+}
+
+//-----------------------------------------------------------------------------------
+void WorkerPool::RunChunks()
+{
+    for (unsigned int chunk = m_nextChunk++; chunk < m_numChunks; chunk = m_nextChunk++)
+    {
+        (*m_job)(chunk);
+    }
+}
+
+//-----------------------------------------------------------------------------------
+void WorkerPool::WorkerMain()
+{
+    unsigned int lastGeneration = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wakeCondition.wait(lock, [&]() { return m_isShuttingDown || m_generation != lastGeneration; });
+            if (m_isShuttingDown)
+            {
+                return;
+            }
+            lastGeneration = m_generation;
+        }
+
+        RunChunks();
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (--m_numBusyWorkers == 0)
+        {
+            m_doneCondition.notify_one();
+        }
+    }
+}
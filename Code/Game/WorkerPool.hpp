@@ -0,0 +1,44 @@
+#pragma once
+#include <vector>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+//Persistent worker threads for splitting a loop into chunks. The calling thread works on chunks too,
+//and ParallelFor doesn't return until every chunk has finished.
+//-----------------------------------------------------------------------------------
+class WorkerPool
+{
+public:
+    //CONSTRUCTORS/////////////////////////////////////////////////////////////////////
+    WorkerPool(unsigned int numWorkers);
+    ~WorkerPool();
+
+    //FUNCTIONS/////////////////////////////////////////////////////////////////////
+    void ParallelFor(unsigned int numChunks, const std::function<void(unsigned int chunkIndex)>& job);
+    inline unsigned int GetNumThreads() const { return m_workers.size() + 1; };
+
+    //STATIC FUNCTIONS/////////////////////////////////////////////////////////////////////
+    static unsigned int CalculateDefaultNumWorkers();
+
+    //STATIC VARIABLES/////////////////////////////////////////////////////////////////////
+    static WorkerPool* instance;
+
+private:
+    void WorkerMain();
+    void RunChunks();
+
+    //MEMBER VARIABLES/////////////////////////////////////////////////////////////////////
+    std::vector<std::thread> m_workers;
+    std::mutex m_mutex;
+    std::condition_variable m_wakeCondition;
+    std::condition_variable m_doneCondition;
+    const std::function<void(unsigned int)>* m_job = nullptr;
+    std::atomic<unsigned int> m_nextChunk;
+    unsigned int m_numChunks = 0;
+    unsigned int m_numBusyWorkers = 0;
+    unsigned int m_generation = 0;
+    bool m_isShuttingDown = false;
+};